@@ -0,0 +1,416 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 ARM Ltd.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Run the debug sequences of the pdsc against a simulated STM32WBA.
+#
+# The script interprets the <debugvars> and <sequences> of the pack
+# description and executes them in the order a debugger uses for the
+# connection modes below, on a model of the debug port, nRESET, the core
+# debug registers, DBGMCU and FLASH_OPTR:
+#
+#   dbgseq_sim.py [--pdsc ../../../Keil.STM32WBAxx_DFP.pdsc] [--baseline] [-v]
+#
+# Every scenario lists the hardware and system resets issued, the final
+# core state and the messages of the sequences, and is checked against
+# the expected result. --baseline runs the same scenarios with the default
+# sequences of the CMSIS-Pack specification for comparison.
+# -----------------------------------------------------------------------------
+
+import argparse
+import glob
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+MASK64 = (1 << 64) - 1
+
+DHCSR = 0xE000EDF0
+DEMCR = 0xE000EDFC
+AIRCR = 0xE000ED0C
+DBGMCU_SCR = 0xE0044004
+FLASH_OPTR = 0x40022040
+
+S_HALT = 1 << 17
+S_RETIRE_ST = 1 << 24
+S_RESET_ST = 1 << 25
+NRESET = 0x80
+
+RDP = {"0": 0xAA, "0.5": 0x55, "1": 0xBB, "2": 0xCC}
+
+
+class TargetError(Exception):
+    """Failed debug access."""
+
+
+class SequenceError(Exception):
+    """Sequence aborted."""
+
+
+class Target:
+    """STM32WBA as seen through the debug port."""
+
+    def __init__(self, power="run", rdp="0", tzen=0):
+        self.power = power                  # run, stop, standby
+        self.rdp = RDP[rdp]
+        self.tzen = tzen
+        self.nreset = False                 # nRESET asserted
+        self.halted = False
+        self.retired = True                 # S_RETIRE_ST
+        self.reset_st = False               # S_RESET_ST
+        self.demcr = 0
+        self.dbgmcu = {}
+        self.hw_resets = 0
+        self.sys_resets = 0
+        self.time = 0                       # us
+
+    # Device
+    def _reset(self):
+        self.power = "run"
+        self.reset_st = True
+        self.halted = False
+        self.retired = False
+
+    def _start(self):
+        if self.demcr & 1:                  # VC_CORERESET
+            self.halted = True
+        else:
+            self.retired = True
+
+    def _dp_ok(self):
+        if self.rdp == RDP["2"]:
+            return False
+        return self.power != "standby" or self.nreset or (self.dbgmcu.get(DBGMCU_SCR, 0) & 4)
+
+    def _ap_ok(self, addr):
+        if not self._dp_ok():
+            return False
+        if addr >= 0xE0000000:
+            return True                     # PPB stays accessible
+        return self.power == "run" or self.nreset or (self.dbgmcu.get(DBGMCU_SCR, 0) & 2)
+
+    def _tick(self, us=10):
+        self.time += us
+        if not self.halted and not self.nreset:
+            self.retired = True
+
+    # Debug access functions
+    def read_dp(self, addr):
+        self._tick()
+        if not self._dp_ok():
+            raise TargetError("no response from the debug port")
+        return {0x0: 0x0BE12477, 0x4: 0xF0000000}.get(addr, 0)
+
+    def write_dp(self, addr, val):
+        self._tick()
+        if not self._dp_ok():
+            raise TargetError("no response from the debug port")
+
+    def read32(self, addr):
+        self._tick()
+        if not self._ap_ok(addr):
+            raise TargetError(f"read of 0x{addr:08X} failed")
+        if addr == DHCSR:
+            val = ((S_HALT if self.halted else 0) | (S_RETIRE_ST if self.retired else 0) |
+                   (S_RESET_ST if self.reset_st else 0) | 1)
+            self.retired = self.reset_st = False
+            return val
+        if addr == DEMCR:
+            return self.demcr
+        if addr == FLASH_OPTR:
+            return self.rdp | (self.tzen << 31)
+        return self.dbgmcu.get(addr, 0)
+
+    def write32(self, addr, val):
+        self._tick()
+        if not self._ap_ok(addr):
+            raise TargetError(f"write of 0x{addr:08X} failed")
+        if addr == DHCSR and (val >> 16) == 0xA05F:
+            self.halted = bool(val & 2)
+        elif addr == DEMCR:
+            self.demcr = val
+        elif addr == AIRCR and (val & 0xFFFF0004) == 0x05FA0004:
+            self.sys_resets += 1
+            self._reset()
+            self._start()
+        elif 0xE0044000 <= addr < 0xE0045000:
+            self.dbgmcu[addr] = val
+
+    def swj_pins(self, out, select, wait):
+        self._tick()
+        if select & NRESET:
+            assert_ = not (out & NRESET)
+            if assert_ and not self.nreset:
+                self.hw_resets += 1
+                self._reset()
+            if not assert_ and self.nreset:
+                self.nreset = False
+                self._start()
+            self.nreset = assert_
+        return 0 if self.nreset else NRESET
+
+    def delay(self, us):
+        self._tick(us)
+
+
+class Interpreter:
+    """Debug sequence language on a Target."""
+
+    def __init__(self, sequences, debugvars, target, connection):
+        self.sequences = sequences
+        self.target = target
+        self.messages = []
+        self.globals = {"__protocol": 0x00010002, "__connection": connection,
+                        "__dp": 0, "__ap": 1, "__errorcontrol": 0, "__Result": 0}
+        self.globals.update(debugvars)
+
+    def _call(self, fn, *args):
+        try:
+            val = fn(*args)
+            self.globals["__Result"] = 0
+            return val if val is not None else 0
+        except TargetError as err:
+            if self.globals["__errorcontrol"] & 1:
+                self.globals["__Result"] = 1
+                return 0
+            raise SequenceError(str(err))
+
+    def _functions(self):
+        t = self.target
+
+        def message(kind, fmt, *args):
+            self.messages.append((kind, fmt))
+            if kind == 2:
+                raise SequenceError(fmt)
+            return 0
+
+        return {
+            "ReadDP":           lambda a: self._call(t.read_dp, a),
+            "WriteDP":          lambda a, v: self._call(t.write_dp, a, v),
+            "Read32":           lambda a: self._call(t.read32, a),
+            "Write32":          lambda a, v: self._call(t.write32, a, v),
+            "DAP_SWJ_Pins":     lambda o, s, w: self._call(t.swj_pins, o, s, w),
+            "DAP_SWJ_Sequence": lambda n, v: self._call(t.delay, 1),
+            "DAP_Delay":        lambda us: self._call(t.delay, us),
+            "Sequence":         lambda name: self.run(name),
+            "Message":          message,
+        }
+
+    @staticmethod
+    def _python(expr):
+        # Sequences in this pack put '&' and '|' in parentheses where C and
+        # Python precedence differ
+        expr = " ".join(expr.split())
+        expr = expr.replace("&&", " and ").replace("||", " or ")
+        return re.sub(r"!(?!=)", " not ", expr)
+
+    def _eval(self, expr, scope):
+        env = dict(self.globals)
+        env.update(scope)
+        env.update(self._functions())
+        val = eval(self._python(expr), {"__builtins__": {}}, env)
+        return int(val) & MASK64
+
+    def _statement(self, stmt, scope):
+        m = re.match(r"__var\s+(\w+)\s*(?:=\s*(.*))?$", stmt, re.S)
+        if m:
+            scope[m.group(1)] = self._eval(m.group(2), scope) if m.group(2) else 0
+            return
+        m = re.match(r"(\w+)\s*=(?!=)\s*(.*)$", stmt, re.S)
+        if m:
+            val = self._eval(m.group(2), scope)
+            if m.group(1) in scope:
+                scope[m.group(1)] = val
+            elif m.group(1) in self.globals:
+                self.globals[m.group(1)] = val
+            else:
+                raise SequenceError(f"undeclared variable {m.group(1)}")
+            return
+        self._eval(stmt, scope)
+
+    def _block(self, text, scope):
+        text = re.sub(r"//[^\n]*", "", text)
+        for stmt in re.findall(r'(?:[^;"]|"[^"]*")+', text):
+            if stmt.strip():
+                self._statement(stmt.strip(), scope)
+
+    def _node(self, node, scope):
+        if node.tag == "block":
+            self._block(node.text or "", scope)
+            return
+        if node.get("if") and not self._eval(node.get("if"), scope):
+            return
+        timeout = int(node.get("timeout", "0"), 0)
+        start = self.target.time
+        while True:
+            if node.get("while") and not self._eval(node.get("while"), scope):
+                break
+            for child in node:
+                self._node(child, scope)
+            if not node.get("while"):
+                break
+            if timeout and self.target.time - start > timeout:
+                raise SequenceError(f"timeout: {node.get('while')}")
+            self.target.delay(100)
+
+    def run(self, name):
+        if name in self.sequences:
+            scope = {}
+            for node in self.sequences[name]:
+                self._node(node, scope)
+        else:
+            DEFAULTS[name](self)
+        return 0
+
+
+# Default sequences of the CMSIS-Pack specification (simplified)
+def _default_port_setup(it):
+    it.globals["__errorcontrol"] = 0
+    it._functions()["ReadDP"](0)
+
+
+def _default_port_start(it):
+    it._functions()["WriteDP"](0x4, 0x50000000)
+
+
+def _default_core_start(it):
+    it._functions()["Write32"](DHCSR, 0xA05F0001)
+
+
+def _default_catch_set(it):
+    f = it._functions()
+    f["Write32"](DEMCR, f["Read32"](DEMCR) | 1)
+    f["Read32"](DHCSR)
+
+
+def _default_catch_clear(it):
+    f = it._functions()
+    f["Write32"](DEMCR, f["Read32"](DEMCR) & ~1)
+
+
+def _default_reset_system(it):
+    f = it._functions()
+    f["Write32"](AIRCR, 0x05FA0004)
+    f["Read32"](DHCSR)
+
+
+def _default_hw_assert(it):
+    it._functions()["DAP_SWJ_Pins"](0, NRESET, 0)
+
+
+def _default_hw_deassert(it):
+    it._functions()["DAP_SWJ_Pins"](NRESET, NRESET, 0)
+
+
+DEFAULTS = {
+    "DebugPortSetup":        _default_port_setup,
+    "DebugPortStart":        _default_port_start,
+    "DebugDeviceUnlock":     lambda it: None,
+    "DebugCoreStart":        _default_core_start,
+    "ResetCatchSet":         _default_catch_set,
+    "ResetCatchClear":       _default_catch_clear,
+    "ResetSystem":           _default_reset_system,
+    "ResetHardwareAssert":   _default_hw_assert,
+    "ResetHardwareDeassert": _default_hw_deassert,
+}
+
+CONNECT = ["DebugPortSetup", "DebugPortStart", "DebugDeviceUnlock", "DebugCoreStart"]
+RESET = ["ResetCatchSet", "ResetSystem", "ResetCatchClear"]
+
+FLOWS = {
+    "attach":      CONNECT,
+    "reset":       CONNECT + RESET,
+    "under-reset": ["ResetHardwareAssert"] + CONNECT +
+                   ["ResetCatchSet", "ResetHardwareDeassert", "ResetCatchClear"] + RESET,
+}
+
+# name, target, flow, connection, expected (connected, hw resets, sys resets, halted, message types)
+SCENARIOS = [
+    ("attach, running",          {},                              "attach",      1, (True, 0, 0, False, [])),
+    ("reset, running",           {},                              "reset",       1, (True, 0, 1, True,  [])),
+    ("under reset, running",     {},                              "under-reset", 1, (True, 1, 0, True,  [])),
+    ("flash, under reset",       {},                              "under-reset", 2, (True, 1, 0, True,  [])),
+    ("attach, Standby",          {"power": "standby"},            "attach",      1, (True, 1, 0, True,  [0])),
+    ("reset, Standby",           {"power": "standby"},            "reset",       1, (True, 1, 0, True,  [0])),
+    ("reset, Stop",              {"power": "stop"},               "reset",       1, (True, 1, 0, True,  [0])),
+    ("under reset, Standby",     {"power": "standby"},            "under-reset", 1, (True, 1, 0, True,  [])),
+    ("reset, RDP 1",             {"rdp": "1"},                    "reset",       1, (True, 0, 1, True,  [1])),
+    ("reset, RDP 0.5 TrustZone", {"rdp": "0.5", "tzen": 1},       "reset",       1, (True, 0, 1, True,  [1])),
+    ("flash, RDP 0.5 TrustZone", {"rdp": "0.5", "tzen": 1},       "reset",       2, (True, 0, 1, True,  [])),
+    ("reset, RDP 2",             {"rdp": "2"},                    "reset",       1, (False, 1, 0, False, [0])),
+]
+
+
+def load(pdsc):
+    root = ET.parse(pdsc).getroot()
+    sequences = {s.get("name"): list(s) for s in root.iter("sequence")}
+    debugvars = {}
+    dv = root.find("devices/family/debugvars")
+    if dv is not None:
+        text = re.sub(r"//[^\n]*", "", dv.text or "")
+        for name, val in re.findall(r"__var\s+(\w+)\s*=\s*([^;]+);", text):
+            debugvars[name] = int(val.strip(), 0)
+    return sequences, debugvars
+
+
+def simulate(sequences, debugvars, target, flow, connection):
+    it = Interpreter(sequences, debugvars, target, connection)
+    try:
+        for name in FLOWS[flow]:
+            it.run(name)
+        connected = True
+    except SequenceError as err:
+        it.messages.append((2, str(err)))
+        connected = False
+    return it, connected
+
+
+def main():
+    pack = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "..")
+    pdsc = sorted(glob.glob(os.path.join(pack, "*.pdsc")))
+    parser = argparse.ArgumentParser(description="Simulate the debug sequences of the pdsc")
+    parser.add_argument("--pdsc", default=pdsc[0] if pdsc else None, help="pack description")
+    parser.add_argument("--baseline", action="store_true", help="use the default sequences only")
+    parser.add_argument("-v", "--verbose", action="store_true", help="print sequence messages")
+    args = parser.parse_args()
+    if args.pdsc is None:
+        parser.error("--pdsc is required")
+
+    sequences, debugvars = load(args.pdsc)
+    if args.baseline:
+        sequences = {}
+
+    failed = 0
+    print(f"{'scenario':26} {'result':10} {'hw':>3} {'sys':>4} {'core':8} {'time':>8}")
+    for name, state, flow, connection, expect in SCENARIOS:
+        target = Target(**state)
+        it, connected = simulate(sequences, debugvars, target, flow, connection)
+        kinds = [k for k, _ in it.messages if connected or k != 2]
+        got = (connected, target.hw_resets, target.sys_resets, target.halted, kinds)
+        ok = got == expect
+        if not args.baseline:
+            failed += not ok
+            if connected and target.dbgmcu.get(DBGMCU_SCR) != debugvars.get("DbgMCU_SCR"):
+                print(f"  {name}: DBGMCU_SCR not configured")
+                failed += 1
+        result = ("connected" if connected else "failed") + ("" if ok or args.baseline else " (!)")
+        core = "halted" if target.halted else "running"
+        print(f"{name:26} {result:10} {target.hw_resets:3} {target.sys_resets:4} {core:8} "
+              f"{target.time / 1000:6.1f}ms")
+        if args.verbose or not (ok or args.baseline):
+            for kind, text in it.messages:
+                print(f"    [{('info', 'warning', 'error')[kind]}] {text}")
+            if not (ok or args.baseline):
+                print(f"    expected {expect}, got {got}")
+
+    if failed:
+        print(f"{failed} scenario(s) failed")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -49,7 +49,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x2000, 0x000000,           // Sector Size 8kB       
@@ -66,7 +66,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x2000, 0x000000,           // Sector Size 8kB       
@@ -83,7 +83,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x2000, 0x000000,           // Sector Size 8kB       
@@ -100,7 +100,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x2000, 0x000000,           // Sector Size 8kB       
@@ -118,7 +118,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x1000, 0x000000,           // Sector Size 8kB       
@@ -135,7 +135,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x1000, 0x000000,           // Sector Size 4kB       
@@ -153,7 +153,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x2000, 0x000000,           // Sector Size 8kB       
@@ -170,7 +170,7 @@
      1024,                       // Programming Page Size
      0,                          // Reserved, must be 0
      0xFF,                       // Initial Content of Erased Memory
-     400,                        // Program Page Timeout 400 mSec
+     800,                        // Program Page Timeout 800 mSec (erase + program)
      400,                        // Erase Sector Timeout 400 mSec
      // Specify Size and Address of Sectors
      0x2000, 0x000000,           // Sector Size 8kB       
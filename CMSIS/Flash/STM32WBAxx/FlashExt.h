@@ -0,0 +1,177 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2014 - 2026 ARM Ltd.
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * In no event will the authors be held liable for any damages arising from
+ * the use of this software. Permission is granted to anyone to use this
+ * software for any purpose, including commercial applications, and to alter
+ * it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software in
+ *    a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0.0.6
+ *
+ * Project:      Extended Flash Programming Functions for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 0.0.6
+ *    Declared EraseWait
+ *  Version 0.0.5
+ *    Added SHA-256 image digest (Digest)
+ *  Version 0.0.4
+ *    Added delta patch programming (ProgramDelta)
+ *  Version 0.0.3
+ *    Added ECC health scan (EccScan)
+ *  Version 0.0.2
+ *    Added compressed readback (Readback)
+ *  Version 0.0.1
+ *    Initial release: command list execution
+ */
+
+/* Note:
+   The functions declared here are additional entry points of the flash
+   algorithm. They are called by the host in the same way as the FlashOS
+   functions (register setup, breakpoint, halt poll) after Init.
+   All structures are located in the algorithm RAM by the host.
+   EraseWait returns the result of the sector erase that EraseSector only
+   started (FLASH_ERASE_ASYNC); the host calls it before reading erased
+   memory or to assign an erase error to the right sector.  */
+
+#ifndef FLASHEXT_H
+#define FLASHEXT_H
+
+// Flash Command Codes
+#define FLASH_CMD_END        0         // End of Command List
+#define FLASH_CMD_ERASE      1         // Erase Sector at adr
+#define FLASH_CMD_PROGRAM    2         // Program sz bytes at adr from buf + arg
+#define FLASH_CMD_BLANK      3         // Blank Check sz bytes at adr, pattern in arg
+#define FLASH_CMD_CRC        4         // Compare CRC-32 of sz bytes at adr with arg
+
+// Flash Command Status
+#define FLASH_STS_OK         0         // Command executed
+#define FLASH_STS_FAILED     1         // Command failed
+#define FLASH_STS_INVALID    2         // Unknown Command Code
+#define FLASH_STS_SKIPPED    0xFFFFFFFF // Not executed (previous command failed)
+
+struct FlashCommand  {
+  unsigned long      cmd;    // Command Code
+  unsigned long      adr;    // Flash Address
+  unsigned long       sz;    // Size in Bytes
+  unsigned long      arg;    // Buffer Offset, Blank Pattern or CRC-32
+  unsigned long   status;    // Command Status (written by ExecuteCommands)
+};
+
+struct FlashReadback  {
+  unsigned long     base;    // Start Address of the complete Readback
+  unsigned long      adr;    // Next Address to read (updated)
+  unsigned long      end;    // End Address of the complete Readback
+  unsigned long    bufSz;    // Size of the Output Buffer
+  unsigned long    outSz;    // Compressed Bytes in the Output Buffer
+};
+
+/* Readback compression format (byte stream, chunks are concatenated):
+     0x00..0x7F          Literal: (T + 1) bytes follow
+     0x80..0xBF  L       Erased:  (((T & 0x3F) << 8) | L) + 1 bytes of 0xFF
+     0xC0..0xFF  O0 O1   Match:   (T & 0x3F) + 4 bytes copied from
+                                  (O1 << 8 | O0) bytes back in the output
+   Matches never reach back before base, so the host can expand the stream
+   of one readback without any other context.  */
+
+#define RB_LIT_MAX         128         // Max Literal Run
+#define RB_RUN_MAX       16384         // Max Erased Run
+#define RB_MATCH_MIN         4         // Min Match Length
+#define RB_MATCH_MAX        67         // Max Match Length
+#define RB_OFFS_MAX      65535         // Max Match Offset
+
+// ECC Page Flags
+#define ECC_CORR          0x01         // Single Error corrected (ECCC)
+#define ECC_DET           0x02         // Double Error detected  (ECCD)
+
+struct FlashEccPage  {
+  unsigned long      adr;    // Address of the first failing Quad-Word
+  unsigned short    page;    // Page Number within Bank
+  unsigned char     bank;    // Bank (1 or 2)
+  unsigned char    flags;    // ECC_CORR, ECC_DET
+  unsigned short   nCorr;    // Single Errors corrected in this Page
+  unsigned short    nDet;    // Double Errors detected in this Page
+};
+
+struct FlashEccReport  {
+  unsigned long   nPages;    // Pages scanned
+  unsigned long    nCorr;    // Single Errors corrected in total
+  unsigned long     nDet;    // Double Errors detected in total
+  unsigned long   maxPage;   // Capacity of page[] (set by Host)
+  unsigned long   nEntry;    // Entries written to page[]
+  struct FlashEccPage page[1];  // Pages with ECC Errors (maxPage entries)
+};
+
+// Delta Patch Status
+#define DL_STS_OK            0         // Sector programmed and verified
+#define DL_STS_SKIPPED       1         // Sector unchanged, not erased
+#define DL_STS_INVALID       2         // Malformed Patch or Sector Address
+#define DL_STS_CRC           3         // Rebuilt Sector does not match crc (nothing erased)
+#define DL_STS_FLASH         4         // Erase or Program failed
+#define DL_STS_VERIFY        5         // Flash does not match crc after programming
+
+struct FlashDelta  {
+  unsigned long      adr;    // Sector Address
+  unsigned long       sz;    // Size of the Patch Stream in Bytes
+  unsigned long      crc;    // CRC-32 of the new Sector
+  unsigned long   status;    // DL_STS_xxx (written by ProgramDelta)
+};
+
+/* Delta patch format (byte stream, rebuilds exactly one sector):
+     0x00..0x7F                  Literal: (T + 1) bytes follow
+     0x80..0xBF  L V             Fill:    (((T & 0x3F) << 8) | L) + 1 bytes of V
+     0xC0..0xFF  L S0 S1 S2 S3   Copy:    (((T & 0x3F) << 8) | L) + 1 bytes from
+                                          the flash at address S (little endian)
+   Copies read the current flash contents, so the host must only reference
+   sectors that are not rewritten before this one.
+   A stream is at most DL_STREAM_MAX bytes, the size of an 8K sector sent
+   as literals only (one token per 128 bytes). The algorithm RAM reserve in
+   Target.lin holds a stream of this size.  */
+
+#define DL_STREAM_MAX   0x2040         // Max Patch Stream Size (0x2000 + 0x2000 / 128)
+
+// Digest Engine
+#define DG_HASH              1         // HASH peripheral
+#define DG_SOFT              2         // Software SHA-256 (HASH not accessible)
+
+struct FlashRange  {
+  unsigned long      adr;    // Start Address
+  unsigned long       sz;    // Size in Bytes
+};
+
+struct FlashDigest  {
+  unsigned long   nRange;    // Entries in range[] (set by Host)
+  unsigned long   engine;    // DG_HASH or DG_SOFT (written by Digest)
+  unsigned char digest[32];  // SHA-256 of all Ranges in order (written by Digest)
+  struct FlashRange range[1];  // Ranges to hash (nRange entries)
+};
+
+// Extended Flash Programming Functions (Called by Host)
+extern int EraseWait       (void);                     // Wait for pending Sector Erase
+extern int ExecuteCommands (struct FlashCommand *cmd,  // Execute Command List
+                            unsigned long num,
+                            unsigned char *buf);
+extern int Readback        (struct FlashReadback *rb,  // Compressed Readback
+                            unsigned char *buf);
+extern int EccScan         (unsigned long adr,         // ECC Health Scan
+                            unsigned long sz,
+                            struct FlashEccReport *rep);
+extern int ProgramDelta    (struct FlashDelta *dl,     // Delta Patch Programming
+                            unsigned char *buf);
+extern int Digest          (struct FlashDigest *dg);   // SHA-256 Image Digest
+
+#endif /* FLASHEXT_H */
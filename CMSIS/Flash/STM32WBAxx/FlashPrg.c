@@ -25,15 +25,51 @@
  * --------------------------------------------------------------------------- */
 
 /* History: *  
+ *  Version 0.0.9
+ *    Init skips the SECBBRx/SECBB2Rx writes when all pages are already
+ *    secure, UnInit locks Flash and restores the SAU region changed by Init
+ *  Version 0.0.8
+ *    Added SHA-256 image digest with the HASH peripheral (Digest)
+ *  Version 0.0.7
+ *    Added delta patch programming (ProgramDelta)
+ *  Version 0.0.6
+ *    Corrected SECBB2Rx offset comments, named PNB and DUALBANK masks
+ *  Version 0.0.5
+ *    Added ECC health scan (EccScan)
+ *  Version 0.0.4
+ *    Added compressed readback (Readback)
+ *  Version 0.0.3
+ *    Added command list execution (ExecuteCommands)
+ *  Version 0.0.2
+ *    Added asynchronous sector erase (FLASH_ERASE_ASYNC)
  *  Version 0.0.1
  *    Initial release
  */
 
 /* Note:
    Flash has 8K sector size.
-   STM32WBAx devices have 2MB Flash SIZE .  */
+   STM32WBAx devices have 2MB Flash SIZE .
+
+   With FLASH_ERASE_ASYNC defined EraseSector only starts the erase and
+   returns. Completion and errors are checked by EraseWait, which is called
+   by the next EraseSector, EraseChip, ProgramPage or UnInit, so the sector
+   erase time overlaps with the host transfer of the next buffer. As
+   ProgramPage may complete an erase first, the Program Page Timeout in
+   FlashDev.c covers an erase and a program. The prebuilt FLM files in
+   CMSIS/Flash are built without FLASH_ERASE_ASYNC.
+
+   The host calls Init and UnInit for every phase of one session (erase,
+   program, verify). Every UnInit locks Flash and restores the SAU region
+   if Init changed it, so every Init runs the key sequence and sets the SAU
+   region of the device info area again; the SAU is only left alone when
+   it already holds that region. What a re-Init skips is the SECBBRx and
+   SECBB2Rx writes: UnInit does not clear the block-based security set by
+   the first phase. The SAU registers are saved by the Init that changes
+   them, so nothing is kept from an earlier session.  */
 
 #include "..\FlashOS.h"        // FlashOS Structures
+#include "FlashExt.h"          // Extended Flash Functions
+#include <stddef.h>
 
 
 typedef volatile unsigned long    vu32;
@@ -54,6 +90,8 @@ typedef          unsigned long     u64;
 #define DBGMCU          ((DBGMCU_TypeDef *) DBGMCU_BASE)
 #define FLASHSIZE_BASE    (0x0BFA07A0)
 
+extern struct FlashDevice const FlashDevice;               /* FlashDev.c */
+
 
 
 // Debug MCU
@@ -98,12 +136,23 @@ typedef struct
   vu32 SECBBR3;          /*!< FLASH secure block-based bank register 3,       Address offset: 0x88 */
   vu32 SECBBR4;          /*!< FLASH secure block-based bank register 4,       Address offset: 0x8C */
   vu32 RESERVED4[4];    /*!< Reserved4,                                      Address offset: 0x90-0x9C */
-  vu32 SECBB2R1;         /* offset: 0x1A0 FLASH secure block-based bank 2 register 1 */
-  vu32 SECBB2R2;         /* offset: 0x1A4 FLASH secure block-based bank 2 register 2 */
-  vu32 SECBB2R3;         /* offset: 0x1A8 FLASH secure block-based bank 2 register 3 */
-  vu32 SECBB2R4;         /* offset: 0x1AC FLASH secure block-based bank 2 register 4 */
+  vu32 SECBB2R1;         /*!< FLASH secure block-based bank 2 register 1,     Address offset: 0xA0 */
+  vu32 SECBB2R2;         /*!< FLASH secure block-based bank 2 register 2,     Address offset: 0xA4 */
+  vu32 SECBB2R3;         /*!< FLASH secure block-based bank 2 register 3,     Address offset: 0xA8 */
+  vu32 SECBB2R4;         /*!< FLASH secure block-based bank 2 register 4,     Address offset: 0xAC */
 } FLASH_TypeDef;
 
+/* Register layout check: array size is negative when an offset is wrong */
+#define FLASH_OFS_CHECK(reg, ofs) \
+  typedef char FLASH_##reg##_ofs_check[(offsetof(FLASH_TypeDef, reg) == (ofs)) ? 1 : -1]
+FLASH_OFS_CHECK(NSSR,     0x20);
+FLASH_OFS_CHECK(NSCR1,    0x28);
+FLASH_OFS_CHECK(ECCR,     0x30);
+FLASH_OFS_CHECK(OPTR,     0x40);
+FLASH_OFS_CHECK(SECBBR1,  0x80);
+FLASH_OFS_CHECK(SECBB2R1, 0xA0);
+FLASH_OFS_CHECK(SECBB2R4, 0xAC);
+
 // Flash Keys
 #define FLASH_KEY1               0x45670123
 #define FLASH_KEY2               0xCDEF89AB
@@ -115,7 +164,8 @@ typedef struct
 #define FLASH_PER               ((u32)(1U <<  1))
 #define FLASH_MER1              ((u32)(1U <<  2))
 #define FLASH_MER2              ((u32)(1U << 15))
-#define FLASH_PNB_MSK           ((u32)(0x7F << 3))
+#define FLASH_PNB_Pos           3
+#define FLASH_PNB_MSK           ((u32)(0x7FU << FLASH_PNB_Pos))
 #define FLASH_BKER              ((u32)(1U << 11))
 #define FLASH_STRT              ((u32)(1U << 16))
 #define FLASH_LOCK              ((u32)(1U << 31))
@@ -137,18 +187,65 @@ typedef struct
 #define FLASH_PGERR             (  FLASH_EOP| FLASH_OPERR  |FLASH_PROGERR| FLASH_WRPERR| FLASH_PGAERR | FLASH_SIZERR  | \
                                  FLASH_PGSERR | FLASH_OPTWERR )
 
+#define FLASH_ERERR             (  FLASH_OPERR | FLASH_WRPERR | FLASH_PGSERR )   /* Sector Erase errors */
+
+// Flash ECC Register definition
+#define FLASH_ECCR_ADDR         ((u32)(0xFFFFFU))         /* ADDR_ECC: offset within bank */
+#define FLASH_ECCR_BK           ((u32)(1U << 21))         /* BK_ECC: bank 2 (dual-bank devices) */
+#define FLASH_ECCR_ECCIE        ((u32)(1U << 24))
+#define FLASH_ECCR_ECCC         ((u32)(1U << 30))
+#define FLASH_ECCR_ECCD         ((u32)(1U << 31))
+
 // Flash option register definitions
 #define FLASH_OPTR_RDP          ((u32)(0xFF ))
 #define FLASH_OPTR_RDP_55       ((u32)(0x55  ))
+#define FLASH_OPTR_DUALBANK     ((u32)( 1U << 21))
 #define FLASH_OBL_LAUNCH        ((u32)( 1U << 27))
 #define FLASH_OPTR_TZEN         ((u32)( 1U << 31))
 
 
 
+#ifdef FLASH_ERASE_ASYNC
+static u32 erasePending;               /* sector erase started, not yet checked */
+#endif /* FLASH_ERASE_ASYNC */
+
+// SAU Registers
+#define SAU_CTRL          (0xE000EDD0)
+#define SAU_RNR           (0xE000EDD8)
+#define SAU_RBAR          (0xE000EDDC)
+#define SAU_RLAR          (0xE000EDE0)
+
+#define SAU_INFO_RBAR     (0x0BFA0700)             /* device info region */
+#define SAU_INFO_RLAR     (0x0BFA08E1)             /* limit, enabled */
+
+static u32 sauSaved;                   /* SAU region changed by Init, restored by UnInit */
+static u32 sauRegs[4];                 /* CTRL, RNR, RBAR, RLAR of region 0 */
+
+// ICACHE Registers
+#define ICACHE_CR         (0x40030400)
+#define ICACHE_SR         (0x40030404)
+#define ICACHE_CR_EN      ((u32)(1U << 0))
+#define ICACHE_CR_INV     ((u32)(1U << 1))
+#define ICACHE_SR_BUSYF   ((u32)(1U << 0))
+
+
 static void DSB(void) {
     __asm("DSB");
 }
 
+/*
+ *  Invalidate ICACHE, so that flash reads after an erase or program
+ *  do not return cached data
+ */
+
+static void CacheInvalidate (void) {
+  if (M32(ICACHE_CR) & ICACHE_CR_EN) {
+    M32(ICACHE_CR) |= ICACHE_CR_INV;
+    while (M32(ICACHE_SR) & ICACHE_SR_BUSYF);
+  }
+  DSB();
+}
+
 /*
  * Get Flash security Mode
  *    Return Value:   0 = non-secure Flash
@@ -226,7 +323,7 @@ static u32 PNBMASK_val (void) {
 	}
 	else
 		{
-			if((GetFlashSize()<0x200000)&&((FLASH->OPTR & 0x200000)==0x0))
+			if((GetFlashSize()<0x200000)&&((FLASH->OPTR & FLASH_OPTR_DUALBANK)==0x0))
 			{
 				PNBMASK_val=(((((*(u32*) 0xBF907A0) & 0xFFF)*0x400))/0x2000)-1;
 			}
@@ -238,6 +335,61 @@ static u32 PNBMASK_val (void) {
 #endif /* FLASH_MEM */
 
 
+/*
+ *  Wait for completion of a Sector Erase started by EraseSector
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  Without FLASH_ERASE_ASYNC EraseSector completes the erase itself and
+ *  EraseWait has nothing to wait for.
+ */
+
+int EraseWait (void) {
+#ifdef FLASH_ERASE_ASYNC
+  u32 status;
+
+  if (erasePending == 0U) {
+    return (0);                                          /* Nothing pending */
+  }
+  erasePending = 0U;
+
+  if ((GetFlashSecureMode() == 0U) || ((FLASH->OPTR & FLASH_OPTR_RDP)==FLASH_OPTR_RDP_55))    // Flash non-secure
+  {
+    /*wait until the operation ends*/
+    while (FLASH->NSSR & FLASH_BSY);
+    status = FLASH->NSSR;
+
+    /*reset CR*/
+    FLASH->NSCR1 &= (~FLASH_PER);
+    FLASH->NSCR1 &= ~(PNBMASK_val() << FLASH_PNB_Pos);
+
+    /*check for error*/
+    if (status & FLASH_ERERR) {
+      FLASH->NSSR  = FLASH_ERERR;                        /* Reset Error Flags */
+      return (1);                                        /* Failed */
+    }
+  }
+  else                                // Flash secure
+  {
+    /*wait until the operation ends*/
+    while (FLASH->SECSR & FLASH_BSY);
+    status = FLASH->SECSR;
+
+    /*reset CR*/
+    FLASH->SECCR1 &= (~FLASH_PER);
+    FLASH->SECCR1 &= ~(PNBMASK_val() << FLASH_PNB_Pos);
+
+    /*check for error*/
+    if (status & FLASH_ERERR) {
+      FLASH->SECSR  = FLASH_ERERR;                       /* Reset Error Flags */
+      return (1);                                        /* Failed */
+    }
+  }
+#endif /* FLASH_ERASE_ASYNC */
+
+  return (0);
+}
+
+
 
 
 
@@ -250,6 +402,7 @@ static u32 PNBMASK_val (void) {
  */
 
 int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
+  u32 rnr;
 
 	/*disable interrupts while programming*/
 	__disable_irq();
@@ -267,12 +420,16 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
 		}
 	else                                // Flash secure
 		{			
-          /* Flash block-based secure */ 
+          /* Flash block-based secure, unless left set by the previous phase */
+          if ((FLASH->SECBBR1 & FLASH->SECBBR2 & FLASH->SECBBR3 & FLASH->SECBBR4) != 0xFFFFFFFF)
+          {
           FLASH-> SECBBR1 = 0xffffffff;
           FLASH-> SECBBR2 = 0xffffffff; 
           FLASH-> SECBBR3 = 0xffffffff;
           FLASH-> SECBBR4 = 0xffffffff; 	
-					if (GetFlashType() == 1U)                        /* Flash secure DUAL BANK */
+          }
+					if ((GetFlashType() == 1U) &&                    /* Flash secure DUAL BANK */
+					    ((FLASH->SECBB2R1 & FLASH->SECBB2R2 & FLASH->SECBB2R3 & FLASH->SECBB2R4) != 0xFFFFFFFF))
 					{
 						/* Flash block-based secure bank2 */
 						FLASH->SECBB2R1 = 0xFFFFFFFF;
@@ -289,11 +446,21 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
           /*Wait until the flash is ready*/
           while (FLASH->SECSR & FLASH_BSY);    
 
-			/*set SAU for device info region*/
-	  	M32(0xE000EDD8)=0x0;
-			M32(0xE000EDDC)=0x0BFA0700;
-			M32(0xE000EDE0)=0x0BFA08E1;
-			M32(0xE000EDD0)=0x1;
+          /*set SAU for device info region, save the registers for UnInit*/
+          rnr = M32(SAU_RNR);
+          M32(SAU_RNR)=0x0;
+          if ((M32(SAU_RBAR) != SAU_INFO_RBAR) || (M32(SAU_RLAR) != SAU_INFO_RLAR) || ((M32(SAU_CTRL) & 1U) == 0U)) {
+            sauRegs[0] = M32(SAU_CTRL);
+            sauRegs[1] = rnr;
+            sauRegs[2] = M32(SAU_RBAR);
+            sauRegs[3] = M32(SAU_RLAR);
+            sauSaved = 1U;
+            M32(SAU_RBAR)=SAU_INFO_RBAR;
+            M32(SAU_RLAR)=SAU_INFO_RLAR;
+            M32(SAU_CTRL)=0x1;
+          } else {
+            M32(SAU_RNR)=rnr;
+          }
 	  }
 		
   return (0);
@@ -306,6 +473,11 @@ int Init (unsigned long adr, unsigned long clk, unsigned long fnc) {
  */
 
 int UnInit (unsigned long fnc) {
+   int err = 0;
+
+#ifdef FLASH_ERASE_ASYNC
+   err = EraseWait();                                       /* Flash is locked also after an error */
+#endif /* FLASH_ERASE_ASYNC */
 
    if ((GetFlashSecureMode() == 0U)|| ((FLASH->OPTR & FLASH_OPTR_RDP)==FLASH_OPTR_RDP_55))   // Flash non-secure
 		{
@@ -318,6 +490,18 @@ int UnInit (unsigned long fnc) {
 		}	
 	DSB();		
 
+	/*restore SAU region changed by Init*/
+	if (sauSaved != 0U) {
+		M32(SAU_CTRL) = 0x0;
+		M32(SAU_RNR)  = 0x0;
+		M32(SAU_RBAR) = sauRegs[2];
+		M32(SAU_RLAR) = sauRegs[3];
+		M32(SAU_RNR)  = sauRegs[1];
+		M32(SAU_CTRL) = sauRegs[0];
+		DSB();
+		sauSaved = 0U;
+	}
+
 #ifdef FLASH_OPT
   FLASH->NSCR1  = FLASH_OBL_LAUNCH;                         /* Load option bytes */
   DSB();
@@ -327,7 +511,7 @@ int UnInit (unsigned long fnc) {
   DSB();
 #endif /* FLASH_OPT */
 
-  return (0);
+  return (err);
 }
 
 /*
@@ -337,6 +521,12 @@ int UnInit (unsigned long fnc) {
 
 
 int EraseChip (void) {
+
+#ifdef FLASH_ERASE_ASYNC
+    if (EraseWait() != 0) {
+      return (1);
+    }
+#endif /* FLASH_ERASE_ASYNC */
 	
     if ((GetFlashSecureMode() == 0U) || ((FLASH->OPTR & FLASH_OPTR_RDP)==FLASH_OPTR_RDP_55))    // Flash non-secure
 		{	
@@ -451,6 +641,12 @@ int EraseChip (void) {
 int EraseSector (unsigned long adr) {
   unsigned long page;
 
+#ifdef FLASH_ERASE_ASYNC
+	if (EraseWait() != 0) {
+		return (1);
+	}
+#endif /* FLASH_ERASE_ASYNC */
+
 	if (adr >= 0x0C000000)
 	{
 		adr = adr - 0x04000000; 
@@ -459,13 +655,13 @@ int EraseSector (unsigned long adr) {
 	
 	if ((GetFlashSecureMode() == 0U) || ((FLASH->OPTR & FLASH_OPTR_RDP)==FLASH_OPTR_RDP_55)) {   // Flash non-secure
 		{
-		FLASH->NSSR  = FLASH_PGAERR;                              /* Reset Error Flags */
+		FLASH->NSSR  = FLASH_PGAERR | FLASH_ERERR;                /* Reset Error Flags */
 		/*page erase enabled*/ 
 		FLASH->NSCR1 |= FLASH_PER;
 		/* Dual-Bank Flash */
     if (GetFlashType() == 1U)
 		{ 		
-					if((GetFlashSize()<0x200000)&&((FLASH->OPTR & 0x200000)==0x0))
+					if((GetFlashSize()<0x200000)&&((FLASH->OPTR & FLASH_OPTR_DUALBANK)==0x0))
 					{
 						page = ((adr >>13) & PNBMASK_val() );   
 					}
@@ -495,12 +691,16 @@ int EraseSector (unsigned long adr) {
 		}			
 		
 		/*set PNB*/				
-    FLASH->NSCR1 &= ~(PNBMASK_val()<<3);
-		FLASH->NSCR1 |= page << 3;
+    FLASH->NSCR1 &= ~(PNBMASK_val() << FLASH_PNB_Pos);
+		FLASH->NSCR1 |= page << FLASH_PNB_Pos;
 		
     /*Start erase operation*/ 				
     FLASH->NSCR1 |= FLASH_STRT;
 		
+#ifdef FLASH_ERASE_ASYNC
+    /*completion is checked by EraseWait*/
+    erasePending = 1U;
+#else
 	  /*wait until the operation ends*/				
     while (FLASH->NSSR & FLASH_BSY); 
 
@@ -512,19 +712,20 @@ int EraseSector (unsigned long adr) {
     }		
     /*reset CR*/
     FLASH->NSCR1 &= (~FLASH_PER);		
-		FLASH->NSCR1 &= ~(PNBMASK_val()<<3);
+		FLASH->NSCR1 &= ~(PNBMASK_val() << FLASH_PNB_Pos);
+#endif /* FLASH_ERASE_ASYNC */
 		}		
 	}
 		
 	else            // Flash secure
 	{
-		FLASH->SECSR  = FLASH_PGAERR;                              /* Reset Error Flags */
+		FLASH->SECSR  = FLASH_PGAERR | FLASH_ERERR;               /* Reset Error Flags */
 		/*page erase enabled*/ 
 		FLASH->SECCR1 |= FLASH_PER;
 	
   if (GetFlashType() == 1U)
 		{
-			if((GetFlashSize()<0x200000)&&((FLASH->OPTR & 0x200000)==0x0))
+			if((GetFlashSize()<0x200000)&&((FLASH->OPTR & FLASH_OPTR_DUALBANK)==0x0))
 					{
 						page = ((adr >>13) & PNBMASK_val() );   
 					}
@@ -554,12 +755,16 @@ int EraseSector (unsigned long adr) {
 				
 		
 		/*set PNB*/
-    FLASH->SECCR1 &= ~(PNBMASK_val()<<3);
-    FLASH->SECCR1 |= page << 3;		
+    FLASH->SECCR1 &= ~(PNBMASK_val() << FLASH_PNB_Pos);
+    FLASH->SECCR1 |= page << FLASH_PNB_Pos;		
 				 
     /*Start the erase operation*/  
     FLASH->SECCR1 |= FLASH_STRT;
 	
+#ifdef FLASH_ERASE_ASYNC
+    /*completion is checked by EraseWait*/
+    erasePending = 1U;
+#else
 	  /*wait until the operation ends*/	
     while (FLASH->SECSR & FLASH_BSY); 				 
 	
@@ -570,7 +775,8 @@ int EraseSector (unsigned long adr) {
     }	
     /*reset CR*/
   FLASH->SECCR1 &= (~FLASH_PER);
- FLASH->SECCR1 &= ~(PNBMASK_val()<<3);
+ FLASH->SECCR1 &= ~(PNBMASK_val() << FLASH_PNB_Pos);
+#endif /* FLASH_ERASE_ASYNC */
 	}
 	
   return (0);                                           
@@ -604,6 +810,12 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf) {
   unsigned long tempadd = 0;
   sz = (sz + 15) & ~15;                                    /* Adjust size for two Doublewords */
 
+#ifdef FLASH_ERASE_ASYNC
+  if (EraseWait() != 0) {                                  /* Sector erase still pending */
+    return (1);
+  }
+#endif /* FLASH_ERASE_ASYNC */
+
   
  if ((GetFlashSecureMode() == 0U) || ((FLASH->OPTR & FLASH_OPTR_RDP)==FLASH_OPTR_RDP_55))        // Flash non-secure
  {
@@ -758,3 +970,699 @@ int ProgramPage (unsigned long adr, unsigned long sz, unsigned char *buf) {
   return (0);
 }
 
+
+/*
+ *  Calculate CRC-32 (IEEE 802.3, reflected, as used by zlib)
+ *    Parameter:      crc:  CRC of preceding data (0 for start)
+ *                    p:    Data
+ *                    sz:   Size in Bytes
+ *    Return Value:   CRC-32
+ */
+
+static const u32 crcTab[16] = {
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+  0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+  0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+static u32 Crc32 (u32 crc, const unsigned char *p, u32 sz) {
+
+  crc = ~crc;
+  while (sz--) {
+    crc ^= *p++;
+    crc  = (crc >> 4) ^ crcTab[crc & 0x0F];
+    crc  = (crc >> 4) ^ crcTab[crc & 0x0F];
+  }
+  return (~crc);
+}
+
+
+/*
+ *  Check Flash Memory against Pattern
+ *    Parameter:      adr:  Start Address
+ *                    sz:   Size in Bytes
+ *                    pat:  Pattern
+ *    Return Value:   0 - all bytes equal pat,  1 - not blank
+ */
+
+static int CheckBlank (unsigned long adr, unsigned long sz, unsigned char pat) {
+  u32 pat32 = pat * 0x01010101U;
+
+  while (sz && (adr & 3)) {
+    if (*((unsigned char *)adr) != pat) return (1);
+    adr++; sz--;
+  }
+  while (sz >= 4) {
+    if (M32(adr) != pat32) return (1);
+    adr += 4; sz -= 4;
+  }
+  while (sz) {
+    if (*((unsigned char *)adr) != pat) return (1);
+    adr++; sz--;
+  }
+  return (0);
+}
+
+
+/*
+ *  Execute Command List
+ *    Parameter:      cmd:  Command List (terminated by FLASH_CMD_END or num)
+ *                    num:  Number of Commands
+ *                    buf:  Data Buffer for FLASH_CMD_PROGRAM
+ *    Return Value:   0 - OK,  1 - Failed (see status of the commands)
+ *
+ *  Commands are executed in order with the same EraseSector and ProgramPage
+ *  functions the host calls otherwise. Execution stops at the first error,
+ *  the remaining commands are marked with FLASH_STS_SKIPPED. Each erase is
+ *  completed by EraseWait before the next command, so an erase error is
+ *  reported in the status of its own command. An erase the host started
+ *  before the list failing skips the whole list. ICACHE is invalidated
+ *  before a blank check or CRC reads the flash.
+ */
+
+int ExecuteCommands (struct FlashCommand *cmd, unsigned long num, unsigned char *buf) {
+  u32 i;
+  int err;
+
+  err = EraseWait();                                       /* erase started by the host */
+
+  for (i = 0U; (i < num) && (cmd[i].cmd != FLASH_CMD_END); i++) {
+    if (err != 0) {
+      cmd[i].status = FLASH_STS_SKIPPED;
+      continue;
+    }
+    switch (cmd[i].cmd) {
+      case FLASH_CMD_ERASE:
+        err = EraseSector(cmd[i].adr);
+        if (err == 0) err = EraseWait();
+        break;
+      case FLASH_CMD_PROGRAM:
+        err = ProgramPage(cmd[i].adr, cmd[i].sz, buf + cmd[i].arg);
+        break;
+      case FLASH_CMD_BLANK:
+        CacheInvalidate();                                 /* erased or programmed before */
+        err = CheckBlank(cmd[i].adr, cmd[i].sz, (unsigned char)cmd[i].arg);
+        break;
+      case FLASH_CMD_CRC:
+        CacheInvalidate();
+        err = (Crc32(0U, (const unsigned char *)cmd[i].adr, cmd[i].sz) != cmd[i].arg) ? 1 : 0;
+        break;
+      default:
+        cmd[i].status = FLASH_STS_INVALID;
+        err = 1;
+        continue;
+    }
+    cmd[i].status = (err != 0) ? FLASH_STS_FAILED : FLASH_STS_OK;
+  }
+
+  return (err);
+}
+
+
+/*
+ *  Compressed Readback of Flash Memory
+ *    Parameter:      rb:   Readback Descriptor (adr and outSz are updated)
+ *                    buf:  Output Buffer (rb->bufSz bytes)
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  Compresses flash from rb->adr on until the output buffer is full or
+ *  rb->end is reached. The host reads rb->outSz bytes from buf and calls
+ *  again until rb->adr == rb->end. Erased areas are run-length encoded,
+ *  other data is LZ compressed with a hash of the last seen positions.
+ */
+
+#define RB_HASH_BITS  10
+
+/* Work buffer shared by Readback and ProgramDelta. Hash entries left by
+   ProgramDelta within one readback are only candidates, every match is
+   compared with the flash contents before it is used. */
+static union {
+  u32           rbHash[1U << RB_HASH_BITS];  /* last address with the same hash */
+  unsigned char dlSector[0x2000];            /* rebuilt sector (ProgramDelta) */
+} work;
+
+static u32 RbHashOf (unsigned long adr) {
+  return ((M32(adr) * 2654435761U) >> (32 - RB_HASH_BITS));
+}
+
+int Readback (struct FlashReadback *rb, unsigned char *buf) {
+  unsigned long adr = rb->adr;
+  unsigned long end = rb->end;
+  unsigned long lit = 0U;                                  /* pending literal bytes */
+  unsigned long out = 0U;
+  unsigned long cand, len, max, h, i;
+
+  if ((adr > end) || (rb->base > adr) || (rb->bufSz < (RB_LIT_MAX + 8))) {
+    return (1);
+  }
+  if (adr == rb->base) {                                   /* new readback */
+    for (i = 0U; i < (1U << RB_HASH_BITS); i++) work.rbHash[i] = 0U;
+  }
+
+#ifdef FLASH_ERASE_ASYNC
+  if (EraseWait() != 0) {
+    return (1);
+  }
+#endif /* FLASH_ERASE_ASYNC */
+
+  /* keep room to flush the literals plus one more item of max 3 bytes */
+  while ((adr < end) && ((out + lit + 1U + 3U) <= rb->bufSz)) {
+    max = end - adr;
+
+    /* erased run */
+    if (*((unsigned char *)adr) == 0xFF) {
+      if (max > RB_RUN_MAX) max = RB_RUN_MAX;
+      for (len = 1U; (len < max) && (*((unsigned char *)(adr + len)) == 0xFF); len++);
+      if (len >= RB_MATCH_MIN) {
+        if (lit) {
+          buf[out++] = (unsigned char)(lit - 1U);
+          for (i = adr - lit; i < adr; i++) buf[out++] = *((unsigned char *)i);
+          lit = 0U;
+        }
+        buf[out++] = (unsigned char)(0x80U | ((len - 1U) >> 8));
+        buf[out++] = (unsigned char) (len - 1U);
+        adr += len;
+        continue;
+      }
+    }
+
+    /* match */
+    if (max >= RB_MATCH_MIN) {
+      h    = RbHashOf(adr);
+      cand = work.rbHash[h];
+      work.rbHash[h] = adr;
+      if ((cand >= rb->base) && (cand < adr) && ((adr - cand) <= RB_OFFS_MAX) &&
+          (M32(cand) == M32(adr))) {
+        if (max > RB_MATCH_MAX) max = RB_MATCH_MAX;
+        for (len = RB_MATCH_MIN; (len < max) &&
+             (*((unsigned char *)(cand + len)) == *((unsigned char *)(adr + len))); len++);
+        if (lit) {
+          buf[out++] = (unsigned char)(lit - 1U);
+          for (i = adr - lit; i < adr; i++) buf[out++] = *((unsigned char *)i);
+          lit = 0U;
+        }
+        buf[out++] = (unsigned char)(0xC0U | (len - RB_MATCH_MIN));
+        buf[out++] = (unsigned char) (adr - cand);
+        buf[out++] = (unsigned char)((adr - cand) >> 8);
+        adr += len;
+        continue;
+      }
+    }
+
+    /* literal */
+    adr++;
+    if (++lit == RB_LIT_MAX) {
+      buf[out++] = (unsigned char)(lit - 1U);
+      for (i = adr - lit; i < adr; i++) buf[out++] = *((unsigned char *)i);
+      lit = 0U;
+    }
+  }
+
+  if (lit) {
+    buf[out++] = (unsigned char)(lit - 1U);
+    for (i = adr - lit; i < adr; i++) buf[out++] = *((unsigned char *)i);
+  }
+
+  rb->adr   = adr;
+  rb->outSz = out;
+  return (0);
+}
+
+
+/*
+ *  ECC Health Scan of Flash Memory
+ *    Parameter:      adr:  Start Address (Quad-Word aligned)
+ *                    sz:   Size in Bytes
+ *                    rep:  Report (rep->maxPage set by the host)
+ *    Return Value:   0 - no ECC error,  1 - ECC errors found or report full
+ *
+ *  Every quad-word of the range is read once and ECCR is checked for a
+ *  corrected (ECCC) or detected (ECCD) error. Address and bank of a report
+ *  entry are taken from ECCR (ADDR_ECC, BK_ECC). ECCD raises an NMI, which
+ *  is caught by a temporary vector table in RAM; the algorithm is position
+ *  independent, so the table is aligned for VTOR at runtime. ICACHE is
+ *  bypassed during the scan so that every quad-word is really read from
+ *  the flash.
+ */
+
+#define SCB_VTOR          (0xE000ED08)
+
+#define ECC_VECTORS       32                     /* entries, VTOR needs 128-byte alignment */
+
+static u32 eccVectorBuf[2 * ECC_VECTORS];  /* table at the first 128-byte boundary */
+static volatile u32 eccDet;            /* ECCR of the ECCD caught by NMI, 0 if none */
+
+static void EccNmiHandler (void) {
+  u32 eccr = FLASH->ECCR;
+
+  if (eccr & FLASH_ECCR_ECCD) {
+    eccDet = eccr;
+    FLASH->ECCR = (eccr & FLASH_ECCR_ECCIE) | FLASH_ECCR_ECCD;  /* Reset ECCD */
+  }
+}
+
+int EccScan (unsigned long adr, unsigned long sz, struct FlashEccReport *rep) {
+  struct FlashEccPage *ent;
+  unsigned long end, bank2, pageSz, pageAdr, a, fail;
+  u32 vtor, icache, eccr, flags, bank, page, i;
+  u32 *vectors;
+  int err = 0;
+
+#ifdef FLASH_ERASE_ASYNC
+  if (EraseWait() != 0) {
+    return (1);
+  }
+#endif /* FLASH_ERASE_ASYNC */
+
+  rep->nPages = 0U;
+  rep->nCorr  = 0U;
+  rep->nDet   = 0U;
+  rep->nEntry = 0U;
+
+  pageSz = FlashDevice.sectors[0].szSector;
+  bank2  = 0xFFFFFFFF;
+  if ((GetFlashType() == 1U) &&
+      !((GetFlashSize() < 0x200000) && ((FLASH->OPTR & FLASH_OPTR_DUALBANK) == 0x0))) {
+    bank2 = GetFlashBank();
+  }
+
+  adr &= ~15UL;
+  end  = adr + sz;
+
+  /* catch ECCD NMI with a copy of the current vector table */
+  vectors = (u32 *)(((u32)eccVectorBuf + 127U) & ~127U);
+  vtor = M32(SCB_VTOR);
+  for (i = 0U; i < ECC_VECTORS; i++) {
+    vectors[i] = M32(vtor + (i << 2));
+  }
+  vectors[2] = (u32)EccNmiHandler;
+  eccDet = 0U;
+  FLASH->ECCR = (FLASH->ECCR & FLASH_ECCR_ECCIE) | FLASH_ECCR_ECCC | FLASH_ECCR_ECCD;
+  DSB();
+  M32(SCB_VTOR) = (u32)vectors;
+
+  /* bypass ICACHE */
+  icache = M32(ICACHE_CR);
+  M32(ICACHE_CR) = icache & ~ICACHE_CR_EN;
+  DSB();
+
+  pageAdr = 0xFFFFFFFF;
+  for (; adr < end; adr += 16) {
+    a = (adr >= 0x0C000000) ? (adr - 0x04000000) : adr;
+    if ((a & ~(pageSz - 1U)) != pageAdr) {                 /* next page */
+      pageAdr = a & ~(pageSz - 1U);
+      rep->nPages++;
+    }
+
+    (void)M32(adr);
+    (void)M32(adr + 4);
+    (void)M32(adr + 8);
+    (void)M32(adr + 12);
+    DSB();
+
+    eccr  = FLASH->ECCR;
+    flags = 0U;
+    if (eccr & FLASH_ECCR_ECCC) {
+      flags |= ECC_CORR;
+      FLASH->ECCR = (eccr & FLASH_ECCR_ECCIE) | FLASH_ECCR_ECCC;  /* Reset ECCC */
+    }
+    if (eccDet) {
+      flags |= ECC_DET;
+      eccr   = eccDet;                                     /* address of the double error */
+      eccDet = 0U;
+    }
+    if (flags == 0U) {
+      continue;
+    }
+
+    if (flags & ECC_CORR) rep->nCorr++;
+    if (flags & ECC_DET)  rep->nDet++;
+
+    /* failing address from ECCR, in the alias of the scan */
+    bank = ((eccr & FLASH_ECCR_BK) && (bank2 != 0xFFFFFFFF)) ? 2U : 1U;
+    fail = ((bank == 2U) ? bank2 : 0x08000000) + (eccr & FLASH_ECCR_ADDR & ~15U);
+    page = (eccr & FLASH_ECCR_ADDR) / pageSz;
+    fail = fail + (adr - a);
+
+    ent = (rep->nEntry != 0U) ? &rep->page[rep->nEntry - 1U] : 0;
+    if ((ent == 0) || (ent->bank != bank) || (ent->page != page)) {
+      if (rep->nEntry >= rep->maxPage) {                   /* report full */
+        err = 1;
+        continue;
+      }
+      ent = &rep->page[rep->nEntry++];
+      ent->adr   = fail;
+      ent->bank  = (unsigned char)bank;
+      ent->page  = (unsigned short)page;
+      ent->flags = 0U;
+      ent->nCorr = 0U;
+      ent->nDet  = 0U;
+    }
+    ent->flags |= (unsigned char)flags;
+    if (flags & ECC_CORR) ent->nCorr++;
+    if (flags & ECC_DET)  ent->nDet++;
+  }
+
+  /* restore ICACHE and vector table */
+  if (icache & ICACHE_CR_EN) {
+    M32(ICACHE_CR) = icache | ICACHE_CR_INV;
+  }
+  M32(SCB_VTOR) = vtor;
+  DSB();
+
+  if ((rep->nCorr != 0U) || (rep->nDet != 0U)) {
+    err = 1;
+  }
+  return (err);
+}
+
+
+/*
+ *  Program Sector from Delta Patch
+ *    Parameter:      dl:   Delta Descriptor (sector, patch size, CRC)
+ *                    buf:  Patch Stream (dl->sz bytes, at most DL_STREAM_MAX)
+ *    Return Value:   0 - OK,  1 - Failed (see dl->status)
+ *
+ *  The new sector contents are rebuilt in RAM from literals, fills and
+ *  copies of the old flash contents. Nothing is erased unless the rebuilt
+ *  sector matches dl->crc; an unchanged sector is not erased at all, and
+ *  erased quad-words are not programmed. The result is verified in flash.
+ */
+
+int ProgramDelta (struct FlashDelta *dl, unsigned char *buf) {
+  unsigned long secSz, out, n, src, i, run;
+  unsigned char *p   = buf;
+  unsigned char *end = buf + dl->sz;
+  unsigned char t;
+
+#ifdef FLASH_ERASE_ASYNC
+  if (EraseWait() != 0) {
+    dl->status = DL_STS_FLASH;
+    return (1);
+  }
+#endif /* FLASH_ERASE_ASYNC */
+
+  secSz = FlashDevice.sectors[0].szSector;
+  if ((secSz > sizeof(work.dlSector)) || (dl->sz > DL_STREAM_MAX) || (dl->adr & (secSz - 1U)) ||
+      (dl->adr < FlashDevice.DevAdr) || ((dl->adr + secSz) > (FlashDevice.DevAdr + FlashDevice.szDev))) {
+    dl->status = DL_STS_INVALID;
+    return (1);
+  }
+
+  /* rebuild the sector */
+  out = 0U;
+  while (p < end) {
+    t = *p++;
+    if (t < 0x80) {                                        /* literal */
+      n = t + 1U;
+      if (((end - p) < (long)n) || ((out + n) > secSz)) break;
+      for (i = 0U; i < n; i++) work.dlSector[out++] = *p++;
+    } else {
+      if ((end - p) < 2) break;
+      n = ((((unsigned long)t & 0x3F) << 8) | *p++) + 1U;
+      if ((out + n) > secSz) break;
+      if (t < 0xC0) {                                      /* fill */
+        t = *p++;
+        for (i = 0U; i < n; i++) work.dlSector[out++] = t;
+      } else {                                             /* copy from flash */
+        if ((end - p) < 4) break;
+        src = p[0] | ((unsigned long)p[1] << 8) | ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+        p  += 4;
+        if ((src < FlashDevice.DevAdr) || ((src + n) > (FlashDevice.DevAdr + FlashDevice.szDev))) break;
+        for (i = 0U; i < n; i++) work.dlSector[out++] = *((unsigned char *)(src + i));
+      }
+    }
+  }
+  if ((p != end) || (out != secSz)) {
+    dl->status = DL_STS_INVALID;
+    return (1);
+  }
+  if (Crc32(0U, work.dlSector, secSz) != dl->crc) {
+    dl->status = DL_STS_CRC;
+    return (1);
+  }
+
+  /* unchanged sector */
+  for (i = 0U; i < secSz; i += 4) {
+    if (M32(dl->adr + i) != *((u32 *)(work.dlSector + i))) break;
+  }
+  if (i == secSz) {
+    dl->status = DL_STS_SKIPPED;
+    return (0);
+  }
+
+  /* erase and program the non-erased quad-words */
+  if (EraseSector(dl->adr) != 0) {
+    dl->status = DL_STS_FLASH;
+    return (1);
+  }
+  i = 0U;
+  while (i < secSz) {
+    if (CheckBlank((unsigned long)(work.dlSector + i), 16, 0xFF) == 0) {   /* erased quad-word */
+      i += 16;
+      continue;
+    }
+    run = 16U;
+    while (((i + run) < secSz) && (CheckBlank((unsigned long)(work.dlSector + i + run), 16, 0xFF) != 0)) {
+      run += 16;
+    }
+    if (ProgramPage(dl->adr + i, run, work.dlSector + i) != 0) {
+      dl->status = DL_STS_FLASH;
+      return (1);
+    }
+    i += run;
+  }
+
+#ifdef FLASH_ERASE_ASYNC
+  /* a sector of all 0xFF programs nothing, the erase may still be running */
+  if (EraseWait() != 0) {
+    dl->status = DL_STS_FLASH;
+    return (1);
+  }
+#endif /* FLASH_ERASE_ASYNC */
+
+  /* verify */
+  CacheInvalidate();
+  if (Crc32(0U, (const unsigned char *)dl->adr, secSz) != dl->crc) {
+    dl->status = DL_STS_VERIFY;
+    return (1);
+  }
+  dl->status = DL_STS_OK;
+  return (0);
+}
+
+
+/*
+ *  SHA-256 Digest of Flash Ranges
+ *    Parameter:      dg:   Digest Descriptor (dg->nRange and range[] set by the host)
+ *    Return Value:   0 - OK,  1 - Failed
+ *
+ *  The ranges are hashed in order as one message, only the 32-byte digest
+ *  is read back by the host. The HASH peripheral is used in the security
+ *  state of the algorithm (secure alias when TZEN is set). When it cannot
+ *  be accessed there, because GTZC or RCC assign it to the other state,
+ *  CR reads back without the algorithm and the digest is computed in
+ *  software. The HASH clock is restored afterwards.
+ */
+
+#define RCC_BASE_NS       (0x46020C00)
+#define RCC_BASE_S        (0x56020C00)
+#define RCC_AHB2ENR       (0x8C)
+#define RCC_HASHEN        ((u32)(1U << 17))
+
+#define HASH_BASE_NS      (0x420C0400)
+#define HASH_BASE_S       (0x520C0400)
+#define HASH_CR           (0x000)
+#define HASH_DIN          (0x004)
+#define HASH_STR          (0x008)
+#define HASH_SR           (0x024)
+#define HASH_HR0          (0x310)
+
+// HASH Register definition
+#define HASH_CR_INIT      ((u32)(1U <<  2))
+#define HASH_CR_BYTE      ((u32)(2U <<  4))        /* DATATYPE: byte swap */
+#define HASH_CR_SHA256    ((u32)(3U << 17))        /* ALGO */
+#define HASH_STR_DCAL     ((u32)(1U <<  8))
+#define HASH_SR_DCIS      ((u32)(1U <<  1))
+#define HASH_SR_BUSY      ((u32)(1U <<  3))
+
+#define ROR(x, n)         (((x) >> (n)) | ((x) << (32 - (n))))
+
+static const u32 shaK[64] = {
+  0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+  0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+  0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+  0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+  0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+  0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+  0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+  0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static const u32 shaH0[8] = {
+  0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+static u32 shaH[8];                    /* software hash state */
+static unsigned char shaBlk[64];       /* software block buffer */
+static u32 shaLen;                     /* bytes hashed in total */
+static u32 hashBase;                   /* HASH peripheral, 0 for software */
+static u32 hashWord;                   /* pending HASH input word */
+static u32 hashCnt;                    /* bytes in hashWord */
+
+static void ShaBlock (void) {
+  u32 w[16];
+  u32 a, b, c, d, e, f, g, h, t1, t2, s0, s1, i;
+
+  for (i = 0U; i < 16U; i++) {
+    w[i] = ((u32)shaBlk[4*i] << 24) | ((u32)shaBlk[4*i+1] << 16) |
+           ((u32)shaBlk[4*i+2] << 8) |  (u32)shaBlk[4*i+3];
+  }
+  a = shaH[0]; b = shaH[1]; c = shaH[2]; d = shaH[3];
+  e = shaH[4]; f = shaH[5]; g = shaH[6]; h = shaH[7];
+  for (i = 0U; i < 64U; i++) {
+    if (i >= 16U) {                                        /* message schedule in place */
+      s0 = w[(i+1) & 15]; s0 = ROR(s0, 7)  ^ ROR(s0, 18) ^ (s0 >> 3);
+      s1 = w[(i+14) & 15]; s1 = ROR(s1, 17) ^ ROR(s1, 19) ^ (s1 >> 10);
+      w[i & 15] += s0 + s1 + w[(i+9) & 15];
+    }
+    t1 = h + (ROR(e, 6) ^ ROR(e, 11) ^ ROR(e, 25)) + ((e & f) ^ (~e & g)) + shaK[i] + w[i & 15];
+    t2 = (ROR(a, 2) ^ ROR(a, 13) ^ ROR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+    h = g; g = f; f = e; e = d + t1;
+    d = c; c = b; b = a; a = t1 + t2;
+  }
+  shaH[0] += a; shaH[1] += b; shaH[2] += c; shaH[3] += d;
+  shaH[4] += e; shaH[5] += f; shaH[6] += g; shaH[7] += h;
+}
+
+static void ShaByte (unsigned char v) {
+  shaBlk[shaLen & 63] = v;
+  shaLen++;
+  if ((shaLen & 63) == 0U) {
+    ShaBlock();
+  }
+}
+
+static void HashWrite (u32 w) {
+  while (M32(hashBase + HASH_SR) & HASH_SR_BUSY);
+  M32(hashBase + HASH_DIN) = w;
+}
+
+static void DigestUpdate (unsigned long adr, unsigned long sz) {
+
+  if (hashBase == 0U) {                                    /* software */
+    while (sz--) {
+      ShaByte(*((unsigned char *)adr++));
+    }
+    return;
+  }
+
+  /* the last bytes stay in hashWord, NBLW is set before they are written */
+  while (sz) {
+    if (hashCnt == 4U) {
+      HashWrite(hashWord);
+      hashWord = 0U;
+      hashCnt  = 0U;
+    }
+    if ((hashCnt == 0U) && ((adr & 3) == 0U) && (sz > 4U)) {
+      while (sz > 4U) {
+        HashWrite(M32(adr));
+        adr += 4; sz -= 4;
+      }
+      continue;
+    }
+    hashWord |= (u32)*((unsigned char *)adr) << (hashCnt * 8);
+    hashCnt++;
+    adr++; sz--;
+  }
+}
+
+int Digest (struct FlashDigest *dg) {
+  u32 rcc, base, ahb2enr, v, i;
+
+#ifdef FLASH_ERASE_ASYNC
+  if (EraseWait() != 0) {
+    return (1);
+  }
+#endif /* FLASH_ERASE_ASYNC */
+
+  for (i = 0U; i < dg->nRange; i++) {
+    if ((dg->range[i].adr + dg->range[i].sz) < dg->range[i].adr) {
+      return (1);                                          /* range wraps */
+    }
+  }
+
+  if ((GetFlashSecureMode() == 0U) || ((FLASH->OPTR & FLASH_OPTR_RDP)==FLASH_OPTR_RDP_55)) {
+    rcc  = RCC_BASE_NS;
+    base = HASH_BASE_NS;
+  } else {
+    rcc  = RCC_BASE_S;
+    base = HASH_BASE_S;
+  }
+
+  /* data written to flash may still be in ICACHE */
+  CacheInvalidate();
+
+  ahb2enr = M32(rcc + RCC_AHB2ENR);
+  M32(rcc + RCC_AHB2ENR) = ahb2enr | RCC_HASHEN;
+  (void)M32(rcc + RCC_AHB2ENR);                            /* clock enable delay */
+  DSB();
+
+  M32(base + HASH_CR) = HASH_CR_SHA256 | HASH_CR_BYTE | HASH_CR_INIT;
+  if ((M32(base + HASH_CR) & (HASH_CR_SHA256 | HASH_CR_BYTE)) == (HASH_CR_SHA256 | HASH_CR_BYTE)) {
+    hashBase   = base;
+    dg->engine = DG_HASH;
+  } else {
+    hashBase   = 0U;
+    dg->engine = DG_SOFT;
+    for (i = 0U; i < 8U; i++) shaH[i] = shaH0[i];
+  }
+  hashWord = 0U;
+  hashCnt  = 0U;
+  shaLen   = 0U;
+
+  for (i = 0U; i < dg->nRange; i++) {
+    DigestUpdate(dg->range[i].adr, dg->range[i].sz);
+  }
+
+  if (hashBase != 0U) {
+    while (M32(base + HASH_SR) & HASH_SR_BUSY);
+    M32(base + HASH_STR) = (hashCnt * 8) & 0x1F;           /* NBLW, 0: all 32 bits */
+    if (hashCnt != 0U) {
+      M32(base + HASH_DIN) = hashWord;
+    }
+    M32(base + HASH_STR) = ((hashCnt * 8) & 0x1F) | HASH_STR_DCAL;
+    while ((M32(base + HASH_SR) & HASH_SR_DCIS) == 0U);
+    for (i = 0U; i < 8U; i++) {
+      v = M32(base + HASH_HR0 + (i << 2));
+      dg->digest[4*i]   = (unsigned char)(v >> 24);
+      dg->digest[4*i+1] = (unsigned char)(v >> 16);
+      dg->digest[4*i+2] = (unsigned char)(v >> 8);
+      dg->digest[4*i+3] = (unsigned char) v;
+    }
+  } else {
+    v = shaLen;                                            /* padding and bit length */
+    ShaByte(0x80);
+    while ((shaLen & 63) != 56U) {
+      ShaByte(0x00);
+    }
+    for (i = 0U; i < 3U; i++) {
+      ShaByte(0x00);
+    }
+    ShaByte((unsigned char)(v >> 29));
+    ShaByte((unsigned char)(v >> 21));
+    ShaByte((unsigned char)(v >> 13));
+    ShaByte((unsigned char)(v >> 5));
+    ShaByte((unsigned char)(v << 3));
+    for (i = 0U; i < 8U; i++) {
+      dg->digest[4*i]   = (unsigned char)(shaH[i] >> 24);
+      dg->digest[4*i+1] = (unsigned char)(shaH[i] >> 16);
+      dg->digest[4*i+2] = (unsigned char)(shaH[i] >> 8);
+      dg->digest[4*i+3] = (unsigned char) shaH[i];
+    }
+  }
+
+  M32(rcc + RCC_AHB2ENR) = ahb2enr;
+  return (0);
+}
@@ -0,0 +1,318 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Project:      Host build of the STM32WBAxx flash algorithm (Digest test)
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Calls Digest of the host copy of FlashPrg.c on an image in host memory:
+
+     digest_host [--hash] image.bin request.bin result.bin
+
+   request.bin is a struct FlashDigest as written by flash_digest.py
+   (32-bit fields) with the range addresses as offsets into the image.
+   result.bin gets the struct in the same layout.
+   Without --hash the HASH peripheral reads back CR = 0, so Digest takes
+   the software SHA-256 path. With --hash a mock HASH peripheral collects
+   the words written to DIN with the DATATYPE swap of CR, keeps the NBLW
+   valid bits of the last word at DCAL, and returns the SHA-256 of the
+   message in HR0..HR7. SR reports BUSY once after every DIN write and
+   after DCAL. Accesses the peripheral would not accept end the program.
+
+   mock_map sees the address of every register access, but not whether
+   it is a read or a write: a HASH access is evaluated at the next call,
+   after the algorithm has written the register.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FlashOS.h"
+#include "FlashExt.h"
+#include "digest_host.h"
+
+#define RANGE_MAX  64
+
+struct FlashDevice const FlashDevice;
+
+unsigned int mock_flash[0x100 / 4];
+unsigned int mock_dbgmcu[1] = { 0x4B0 };
+
+static unsigned int mock_rcc[0x100 / 4];
+static unsigned int mock_icache[4];
+
+// HASH registers
+#define HASH_CR           (0x000 / 4)
+#define HASH_DIN          (0x004 / 4)
+#define HASH_STR          (0x008 / 4)
+#define HASH_SR           (0x024 / 4)
+#define HASH_HR0          (0x310 / 4)
+
+#define HASH_CR_INIT      (1U <<  2)
+#define HASH_CR_DATATYPE  (3U <<  4)
+#define HASH_CR_ALGO      (3U << 17)
+#define HASH_STR_NBLW     (0x1FU)
+#define HASH_STR_DCAL     (1U <<  8)
+#define HASH_SR_DCIS      (1U <<  1)
+#define HASH_SR_BUSY      (1U <<  3)
+
+#define RCC_AHB2ENR       (0x8C / 4)
+#define RCC_HASHEN        (1U << 17)
+
+static int            hash_on;          // --hash: HASH peripheral accessible
+static unsigned int   mock_hash[0x400 / 4];
+static int            hash_last = -1;   // register of the previous access
+static int            hash_busy;        // SR reads with BUSY left
+static unsigned char *hash_msg;         // message collected from DIN
+static unsigned long  hash_len, hash_max;
+
+static const unsigned char *mem_base;   // image, read directly by Digest
+static unsigned long        mem_size;
+
+static void fail (const char *msg) {
+  fprintf(stderr, "HASH: %s\n", msg);
+  exit(2);
+}
+
+#define ROR(x, n)         (((x) >> (n)) | ((x) << (32 - (n))))
+
+/* Reference SHA-256 of the collected message into HR0..HR7 */
+static void hash_sha256 (void) {
+  static const unsigned int k[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+  };
+  unsigned int h[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+  };
+  unsigned int w[64], v[8], t1, t2;
+  unsigned long n, i, j, bits = hash_len * 8U;
+  unsigned char *m;
+
+  n = ((hash_len + 8U) / 64U + 1U) * 64U;       // padded length
+  m = calloc(n, 1U);
+  if (m == NULL) fail("out of memory");
+  memcpy(m, hash_msg, hash_len);
+  m[hash_len] = 0x80U;
+  for (i = 0U; i < 8U; i++) {
+    m[n - 1U - i] = (unsigned char)(bits >> (8U * i));
+  }
+
+  for (j = 0U; j < n; j += 64U) {
+    for (i = 0U; i < 16U; i++) {
+      w[i] = ((unsigned int)m[j + 4*i] << 24) | ((unsigned int)m[j + 4*i + 1] << 16) |
+             ((unsigned int)m[j + 4*i + 2] << 8) | m[j + 4*i + 3];
+    }
+    for (i = 16U; i < 64U; i++) {
+      w[i] = w[i-16] + (ROR(w[i-15], 7) ^ ROR(w[i-15], 18) ^ (w[i-15] >> 3)) +
+             w[i-7]  + (ROR(w[i-2], 17) ^ ROR(w[i-2], 19)  ^ (w[i-2] >> 10));
+    }
+    memcpy(v, h, sizeof(v));
+    for (i = 0U; i < 64U; i++) {
+      t1 = v[7] + (ROR(v[4], 6) ^ ROR(v[4], 11) ^ ROR(v[4], 25)) + ((v[4] & v[5]) ^ (~v[4] & v[6])) + k[i] + w[i];
+      t2 = (ROR(v[0], 2) ^ ROR(v[0], 13) ^ ROR(v[0], 22)) + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+      memmove(&v[1], &v[0], 7U * sizeof(v[0]));
+      v[4] += t1;
+      v[0]  = t1 + t2;
+    }
+    for (i = 0U; i < 8U; i++) {
+      h[i] += v[i];
+    }
+  }
+  free(m);
+  memcpy(&mock_hash[HASH_HR0], h, sizeof(h));
+}
+
+/* Append a DIN word to the message, swapped as selected by DATATYPE */
+static void hash_din (unsigned int d) {
+  static const unsigned char order[3][4] = {
+    { 24, 16, 8, 0 },                   // 32-bit data: no swap
+    { 8, 0, 24, 16 },                   // 16-bit data: half-words swapped
+    { 0, 8, 16, 24 }                    // 8-bit data: bytes swapped
+  };
+  unsigned int type = (mock_hash[HASH_CR] & HASH_CR_DATATYPE) >> 4;
+  unsigned int i;
+
+  if (type > 2U) fail("bit string DATATYPE not supported");
+  if (hash_len + 4U > hash_max) {
+    hash_max = (hash_max * 2U) + 64U;
+    hash_msg = realloc(hash_msg, hash_max);
+    if (hash_msg == NULL) fail("out of memory");
+  }
+  for (i = 0U; i < 4U; i++) {
+    hash_msg[hash_len++] = (unsigned char)(d >> order[type][i]);
+  }
+  hash_busy = 1;
+}
+
+/* Evaluate the previous HASH access, the algorithm has completed it */
+static void hash_update (void) {
+  unsigned int nblw;
+
+  switch (hash_last) {
+    case HASH_CR:
+      if ((mock_hash[HASH_CR] & HASH_CR_ALGO) != HASH_CR_ALGO) fail("ALGO is not SHA-256");
+      if (mock_hash[HASH_CR] & HASH_CR_INIT) {
+        mock_hash[HASH_CR] &= ~HASH_CR_INIT;    // write only
+        mock_hash[HASH_SR]  = 0U;
+        hash_len = 0U;
+      }
+      break;
+    case HASH_DIN:
+      if (mock_hash[HASH_SR] & HASH_SR_DCIS) fail("DIN written after DCAL without INIT");
+      hash_din(mock_hash[HASH_DIN]);
+      break;
+    case HASH_STR:
+      if (mock_hash[HASH_STR] & HASH_STR_DCAL) {
+        mock_hash[HASH_STR] &= ~HASH_STR_DCAL;  // write only
+        nblw = mock_hash[HASH_STR] & HASH_STR_NBLW;
+        if (nblw & 7U) fail("NBLW not a multiple of 8 for byte data");
+        if (nblw != 0U) {
+          if (hash_len < 4U) fail("NBLW set without a last word");
+          hash_len -= 4U - (nblw / 8U);         // valid bits of the last word
+        }
+        hash_sha256();
+        hash_busy = 1;
+        mock_hash[HASH_SR] |= HASH_SR_DCIS;
+      }
+      break;
+    default:
+      break;
+  }
+  hash_last = -1;
+}
+
+/* HASH register at offset ofs */
+static void *hash_map (unsigned long ofs) {
+  static unsigned int zero;
+  int reg = (int)(ofs / 4U);
+
+  if (!hash_on || ((mock_rcc[RCC_AHB2ENR] & RCC_HASHEN) == 0U)) {
+    zero = 0U;                          // HASH not accessible or not clocked
+    return &zero;
+  }
+  if ((reg != HASH_CR) && (reg != HASH_DIN) && (reg != HASH_STR) && (reg != HASH_SR) &&
+      ((reg < HASH_HR0) || (reg >= HASH_HR0 + 8))) {
+    fail("access to an unused register");
+  }
+  if ((reg >= HASH_HR0) && ((mock_hash[HASH_SR] & HASH_SR_DCIS) == 0U)) {
+    fail("HR read before DCIS");
+  }
+  if (reg == HASH_SR) {
+    if (hash_busy != 0) {
+      hash_busy--;
+      mock_hash[HASH_SR] |=  HASH_SR_BUSY;
+    } else {
+      mock_hash[HASH_SR] &= ~HASH_SR_BUSY;
+    }
+  }
+  hash_last = reg;
+  return &mock_hash[reg];
+}
+
+void *mock_map (unsigned long adr) {
+
+  hash_update();
+  if (((adr & ~0x3FFUL) == 0x420C0400UL) || ((adr & ~0x3FFUL) == 0x520C0400UL)) {
+    return hash_map(adr & 0x3FFU);
+  }
+  if ((adr >= (unsigned long)mem_base) && (adr < (unsigned long)mem_base + mem_size)) {
+    return (void *)adr;                 // image word read by the HASH path
+  }
+  if (((adr & ~0xFFUL) == 0x46020C00UL) || ((adr & ~0xFFUL) == 0x56020C00UL)) {
+    return (char *)mock_rcc + (adr & 0xFFU);
+  }
+  if ((adr & ~0xFUL) == 0x40030400UL) {
+    return (char *)mock_icache + (adr & 0xFU);
+  }
+  fprintf(stderr, "unexpected register access at 0x%08lX\n", adr);
+  exit(2);
+}
+
+static unsigned char *load (const char *name, long *size) {
+  unsigned char *data;
+  FILE *f = fopen(name, "rb");
+
+  if (f == NULL) {
+    perror(name);
+    exit(2);
+  }
+  fseek(f, 0, SEEK_END);
+  *size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  data = malloc((size_t)*size + 1U);
+  if ((data == NULL) || (fread(data, 1U, (size_t)*size, f) != (size_t)*size)) {
+    perror(name);
+    exit(2);
+  }
+  fclose(f);
+  return data;
+}
+
+static unsigned long get32 (const unsigned char *p) {
+  return p[0] | ((unsigned long)p[1] << 8) | ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+}
+
+static void put32 (unsigned char *p, unsigned long v) {
+  p[0] = (unsigned char)v;
+  p[1] = (unsigned char)(v >> 8);
+  p[2] = (unsigned char)(v >> 16);
+  p[3] = (unsigned char)(v >> 24);
+}
+
+int main (int argc, char **argv) {
+  static unsigned char dgBuf[sizeof(struct FlashDigest) + (RANGE_MAX * sizeof(struct FlashRange))];
+  struct FlashDigest *dg = (struct FlashDigest *)dgBuf;
+  unsigned char *img, *req, res[40];
+  long imgSz, reqSz;
+  unsigned long i;
+  FILE *f;
+
+  if ((argc == 5) && (strcmp(argv[1], "--hash") == 0)) {
+    hash_on = 1;
+    argc--;
+    argv++;
+  }
+  if (argc != 4) {
+    fprintf(stderr, "usage: digest_host [--hash] image.bin request.bin result.bin\n");
+    return 2;
+  }
+  img = load(argv[1], &imgSz);
+  req = load(argv[2], &reqSz);
+  mem_base = img;
+  mem_size = (unsigned long)imgSz;
+
+  dg->nRange = get32(req);
+  if ((dg->nRange > RANGE_MAX) || (reqSz != (long)(40U + (dg->nRange * 8U)))) {
+    fprintf(stderr, "%s: bad request\n", argv[2]);
+    return 2;
+  }
+  for (i = 0U; i < dg->nRange; i++) {
+    dg->range[i].adr = (unsigned long)img + get32(req + 40U + (i * 8U));
+    dg->range[i].sz  = get32(req + 44U + (i * 8U));
+  }
+
+  if (Digest(dg) != 0) {
+    fprintf(stderr, "Digest failed\n");
+    return 1;
+  }
+
+  put32(res,     dg->nRange);
+  put32(res + 4, dg->engine);
+  memcpy(res + 8, dg->digest, 32U);
+  f = fopen(argv[3], "wb");
+  if ((f == NULL) || (fwrite(res, 1U, sizeof(res), f) != sizeof(res))) {
+    perror(argv[3]);
+    return 2;
+  }
+  fclose(f);
+  return 0;
+}
@@ -0,0 +1,22 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Project:      Host build of the STM32WBAxx flash algorithm (Digest test)
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Included by the host copy of FlashPrg.c that test_flash_digest.py
+   generates: register accesses go through mock_map.  */
+
+#ifndef DIGEST_HOST_H
+#define DIGEST_HOST_H
+
+#define __disable_irq()
+
+extern unsigned int  mock_flash[0x100 / 4];     // FLASH registers, all 0 (TrustZone off)
+extern unsigned int  mock_dbgmcu[1];            // DBGMCU IDCODE
+extern void         *mock_map (unsigned long adr);
+
+#endif /* DIGEST_HOST_H */
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 ARM Ltd.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Host test of the Digest entry point in CMSIS/Flash/STM32WBAxx/FlashPrg.c,
+# with the HASH peripheral and with the software SHA-256.
+#
+# FlashPrg.c is copied with its register accesses redirected to the mocks
+# of digest_host.c and built with the host C compiler (gcc, or $CC) with
+# -Wall -Werror; only the pointer/integer cast warnings of the 64-bit host
+# are disabled, and tabs are 2 columns as in the editor of the sources.
+# Every case writes the request with flash_digest.py and runs the host
+# build twice: with the mock HASH peripheral, which checks the DIN words
+# as swapped by DATATYPE and the NBLW valid bits, and without it, so that
+# Digest falls back to software. Both results are checked with
+# flash_digest.py against hashlib:
+#
+#   test_flash_digest.py [--keep DIR]
+#
+# The cases cover message lengths around the padding boundaries (55, 56
+# and 64 bytes per block), ranges split at every byte of such messages,
+# unaligned, repeated and empty ranges, and a large image.
+# -----------------------------------------------------------------------------
+
+import argparse
+import hashlib
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+FLASH = os.path.normpath(os.path.join(HERE, "..", ".."))
+sys.path.insert(0, os.path.dirname(HERE))
+sys.dont_write_bytecode = True
+
+import flash_digest  # noqa: E402
+
+# FlashPrg.c text -> host replacement, each must match exactly once
+HOST_EDITS = [
+    ('#include "..\\FlashOS.h"', '#include "FlashOS.h"\n#include "digest_host.h"'),
+    ("typedef volatile unsigned long    vu32;", "typedef volatile unsigned int     vu32;"),
+    ("typedef          unsigned long     u32;", "typedef          unsigned int      u32;"),
+    ("#define M32(adr) (*((vu32 *) (adr)))", "#define M32(adr) (*((vu32 *) mock_map(adr)))"),
+    ("((FLASH_TypeDef  *) FLASH_BASE)", "((FLASH_TypeDef  *) mock_flash)"),
+    ("((DBGMCU_TypeDef *) DBGMCU_BASE)", "((DBGMCU_TypeDef *) mock_dbgmcu)"),
+    ('__asm("DSB");', ""),
+]
+
+
+def host_source(src):
+    for old, new in HOST_EDITS:
+        if src.count(old) != 1:
+            raise RuntimeError(f"FlashPrg.c: '{old}' found {src.count(old)} times")
+        src = src.replace(old, new)
+    # direct reads of the device info area
+    return re.sub(r"\(\*\(u32\*\) ?(0x[0-9A-Fa-f]+|FLASHSIZE_BASE)\)", r"(*(u32*)mock_map(\1))", src)
+
+
+def build(work):
+    with open(os.path.join(FLASH, "STM32WBAxx", "FlashPrg.c")) as f:
+        src = host_source(f.read())
+    prg = os.path.join(work, "FlashPrg_host.c")
+    with open(prg, "w") as f:
+        f.write(src)
+    exe = os.path.join(work, "digest_host")
+    cmd = [os.environ.get("CC", "gcc"), "-std=gnu99", "-O1", "-Wall", "-Werror", "-ftabstop=2",
+           "-Wno-int-to-pointer-cast", "-Wno-pointer-to-int-cast", "-DFLASH_MEM", "-DSTM32WBAxx_1024_NSecure",
+           "-I", HERE, "-I", FLASH, "-I", os.path.join(FLASH, "STM32WBAxx"),
+           "-o", exe, os.path.join(HERE, "digest_host.c"), prg]
+    subprocess.run(cmd, check=True)
+    return exe
+
+
+def cases(size):
+    """(name, ranges) with ranges as (offset, size) into the image."""
+    for n in (0, 1, 3, 4, 5, 54, 55, 56, 57, 63, 64, 65, 118, 119, 120, 121, 127, 128, 129, 1000):
+        yield f"length {n}", [(0, n)]
+        yield f"length {n} at offset 3", [(3, n)]
+    for n in (55, 56, 64, 119, 120, 128):
+        for cut in range(n + 1):
+            yield f"length {n} split at {cut}", [(0, cut), (cut, n - cut)]
+    for n in (56, 64, 120):
+        for a in range(1, n, 7):
+            for b in range(a, n, 11):
+                yield f"length {n} split at {a}, {b}", [(1, a - 1), (a, b - a), (b, n - b + 1)]
+    yield "repeated ranges", [(100, 57), (100, 57), (0, 0), (100, 7)]
+    yield "many ranges", [(i * 37, i) for i in range(64)]
+    yield "image", [(0, size)]
+    yield "image in 3 parts", [(0, 70001), (70001, 1), (70002, size - 70002)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Host test of the Digest SHA-256")
+    parser.add_argument("--keep", help="build and work directory to keep")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        work = args.keep or tmp
+        os.makedirs(work, exist_ok=True)
+        exe = build(work)
+
+        image = bytes((i * 1103515245 + 12345) >> 16 & 0xFF for i in range(200000))
+        img = os.path.join(work, "image.bin")
+        req = os.path.join(work, "request.bin")
+        res = os.path.join(work, "result.bin")
+        with open(img, "wb") as f:
+            f.write(image)
+
+        count = fails = 0
+        for name, ranges in cases(len(image)):
+            with open(req, "wb") as f:
+                f.write(flash_digest.request(ranges))
+            ref = hashlib.sha256(flash_digest.message(image, 0, ranges)).digest()
+            for expect, opt in ((1, ["--hash"]), (2, [])):
+                count += 1
+                subprocess.run([exe] + opt + [img, req, res], check=True)
+                engine, digest = flash_digest.result(res)
+                if engine != expect or digest != ref:
+                    fails += 1
+                    print(f"FAIL {name}: engine {engine}, {digest.hex()} != {ref.hex()}")
+
+    print(f"{count - fails} of {count} digests match hashlib")
+    return 1 if fails else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 ARM Ltd.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Encode a delta patch for the ProgramDelta entry point of the STM32WBAxx
+# flash algorithm (see STM32WBAxx/FlashExt.h).
+#
+# The patch rebuilds every changed sector of the installed image from
+# literals, fills and copies of data already in flash. Unchanged sectors
+# are not part of the patch:
+#
+#   flash_delta.py old.bin new.bin patch.bin --base 0x08000000 [--sector 0x2000]
+#
+# patch.bin holds one record per changed sector in programming order:
+#   adr, sz, crc, 0     four 32-bit little endian words (struct FlashDelta)
+#   stream              sz bytes, padded with 0xFF to a multiple of 4
+# The host loads the header to a struct FlashDelta, the stream to the
+# buffer, and calls ProgramDelta once per record. A stream longer than
+# DL_STREAM_MAX (FlashExt.h) does not fit the algorithm RAM and is rejected.
+# -----------------------------------------------------------------------------
+
+import argparse
+import itertools
+import struct
+import sys
+import zlib
+
+GRAM = 8                # bytes hashed for copy candidates
+COPY_MIN = 8            # shorter copies cost more than literals
+FILL_MIN = 4
+LEN_MAX = 16384
+LIT_MAX = 128
+CANDIDATES = 16
+STREAM_MAX = 0x2040     # DL_STREAM_MAX
+
+
+class Encoder:
+    """Delta encoder tracking the flash contents while sectors are rewritten."""
+
+    def __init__(self, old, base, sector):
+        self.flash = bytearray(old)
+        self.base = base
+        self.sector = sector
+        self.index = {}
+        for pos in range(0, len(self.flash) - GRAM + 1):
+            self.index.setdefault(bytes(self.flash[pos:pos + GRAM]), set()).add(pos)
+
+    def _reindex(self, start, new):
+        lo = max(0, start - GRAM + 1)
+        hi = min(len(self.flash) - GRAM + 1, start + len(new))
+        for pos in range(lo, hi):
+            self.index[bytes(self.flash[pos:pos + GRAM])].discard(pos)
+        self.flash[start:start + len(new)] = new
+        for pos in range(lo, hi):
+            self.index.setdefault(bytes(self.flash[pos:pos + GRAM]), set()).add(pos)
+
+    def _match(self, data, i, pos_hint):
+        limit = min(len(data) - i, LEN_MAX)
+        best_len, best_pos = 0, 0
+        cands = []
+        if pos_hint + GRAM <= len(self.flash):
+            cands.append(pos_hint)                       # same place in the old image
+        if limit >= GRAM:
+            cands += itertools.islice(self.index.get(bytes(data[i:i + GRAM]), ()), CANDIDATES)
+        for pos in cands:
+            n = 0
+            while n < limit and pos + n < len(self.flash) and self.flash[pos + n] == data[i + n]:
+                n += 1
+            if n > best_len:
+                best_len, best_pos = n, pos
+        return best_len, best_pos
+
+    def encode(self, start, data):
+        """Patch stream that rebuilds data at flash offset start."""
+        out = bytearray()
+        lit = bytearray()
+
+        def flush():
+            while lit:
+                chunk = lit[:LIT_MAX]
+                out.append(len(chunk) - 1)
+                out.extend(chunk)
+                del lit[:LIT_MAX]
+
+        i = 0
+        while i < len(data):
+            run = 1
+            while i + run < len(data) and run < LEN_MAX and data[i + run] == data[i]:
+                run += 1
+            mlen, mpos = self._match(data, i, start + i)
+            if mlen >= COPY_MIN and mlen >= run:
+                flush()
+                src = self.base + mpos
+                out += bytes((0xC0 | ((mlen - 1) >> 8), (mlen - 1) & 0xFF))
+                out += struct.pack("<I", src)
+                i += mlen
+            elif run >= FILL_MIN:
+                flush()
+                out += bytes((0x80 | ((run - 1) >> 8), (run - 1) & 0xFF, data[i]))
+                i += run
+            else:
+                lit.append(data[i])
+                i += 1
+        flush()
+        return bytes(out)
+
+    def program(self, start, data):
+        self._reindex(start, data)
+
+
+def apply(flash, base, adr, stream, sector):
+    """Reference decoder of ProgramDelta, returns the rebuilt sector."""
+    out = bytearray()
+    i = 0
+    while i < len(stream):
+        t = stream[i]
+        i += 1
+        if t < 0x80:
+            out += stream[i:i + t + 1]
+            i += t + 1
+            continue
+        n = (((t & 0x3F) << 8) | stream[i]) + 1
+        i += 1
+        if t < 0xC0:
+            out += bytes([stream[i]]) * n
+            i += 1
+        else:
+            src = struct.unpack_from("<I", stream, i)[0] - base
+            i += 4
+            out += flash[src:src + n]
+    if len(out) != sector:
+        raise ValueError(f"sector 0x{adr:08X}: rebuilt {len(out)} bytes")
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encode a delta patch for the STM32WBAxx flash algorithm")
+    parser.add_argument("old", help="image installed in flash")
+    parser.add_argument("new", help="image to program")
+    parser.add_argument("output", help="patch file to write")
+    parser.add_argument("--base", type=lambda x: int(x, 0), default=0x08000000,
+                        help="flash address of the images (default 0x08000000)")
+    parser.add_argument("--sector", type=lambda x: int(x, 0), default=0x2000,
+                        help="sector size (default 0x2000)")
+    args = parser.parse_args()
+
+    with open(args.old, "rb") as f:
+        old = f.read()
+    with open(args.new, "rb") as f:
+        new = f.read()
+    size = max(len(old), len(new))
+    size = (size + args.sector - 1) // args.sector * args.sector
+    old = old.ljust(size, b"\xFF")
+    new = new.ljust(size, b"\xFF")
+
+    enc = Encoder(old, args.base, args.sector)
+    check = bytearray(old)
+    patch = bytearray()
+    changed = 0
+    for start in range(0, size, args.sector):
+        data = new[start:start + args.sector]
+        if data == old[start:start + args.sector]:
+            continue
+        stream = enc.encode(start, data)
+        adr = args.base + start
+        if apply(check, args.base, adr, stream, args.sector) != data:
+            print(f"error: sector 0x{adr:08X} does not rebuild", file=sys.stderr)
+            return 1
+        if len(stream) > STREAM_MAX:
+            print(f"error: sector 0x{adr:08X}: patch stream of {len(stream)} bytes exceeds {STREAM_MAX}",
+                  file=sys.stderr)
+            return 1
+        check[start:start + args.sector] = data
+        enc.program(start, data)
+        patch += struct.pack("<IIII", adr, len(stream), zlib.crc32(data), 0)
+        patch += stream.ljust((len(stream) + 3) & ~3, b"\xFF")
+        changed += 1
+
+    with open(args.output, "wb") as f:
+        f.write(patch)
+    used = len(new.rstrip(b"\xFF"))
+    print(f"{changed} of {size // args.sector} sectors changed, patch {len(patch)} bytes, image {used} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
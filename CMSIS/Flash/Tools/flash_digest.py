@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 ARM Ltd.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Request and check the SHA-256 digest computed by the Digest entry point of
+# the STM32WBAxx flash algorithm (see STM32WBAxx/FlashExt.h).
+#
+# The ranges are hashed in order as one message. Without --range the whole
+# image is one range. Write the struct FlashDigest for the target:
+#
+#   flash_digest.py image.bin --base 0x08000000 --request dg.bin
+#       [--range 0x08000000:0x4000 --range 0x08010000:0x800]
+#
+# The host loads dg.bin to the algorithm RAM and calls Digest with its
+# address. Then check the result against hashlib with the same ranges:
+#
+#   flash_digest.py image.bin --base 0x08000000 --check result.bin
+#
+# result.bin is the struct read back from the target (engine and digest are
+# reported) or just the 32 digest bytes; --check also takes a hex string.
+# Bytes of a range outside the image are taken as erased (0xFF).
+# Test/test_flash_digest.py checks the software SHA-256 of Digest on the host.
+# -----------------------------------------------------------------------------
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+ERASED = 0xFF
+ENGINES = {1: "HASH", 2: "software"}
+
+
+def parse_range(text):
+    adr, _, size = text.partition(":")
+    return int(adr, 0), int(size, 0)
+
+
+def message(image, base, ranges):
+    """Bytes of all ranges in order, erased outside the image."""
+    out = bytearray()
+    for adr, size in ranges:
+        chunk = bytearray([ERASED]) * size
+        lo, hi = max(adr, base), min(adr + size, base + len(image))
+        if lo < hi:
+            chunk[lo - adr:hi - adr] = image[lo - base:hi - base]
+        out += chunk
+    return bytes(out)
+
+
+def request(ranges):
+    """struct FlashDigest with nRange and range[] filled in."""
+    data = struct.pack("<II", len(ranges), 0) + bytes(32)
+    for adr, size in ranges:
+        data += struct.pack("<II", adr, size)
+    return data
+
+
+def result(text):
+    """(engine, digest) from a file or hex string, engine None if unknown."""
+    if os.path.isfile(text):
+        with open(text, "rb") as f:
+            data = f.read()
+    else:
+        data = bytes.fromhex(text)
+    if len(data) == 32:
+        return None, data
+    if len(data) >= 40:
+        return struct.unpack_from("<I", data, 4)[0], data[8:40]
+    raise ValueError(f"{len(data)} bytes, expected a 32-byte digest or struct FlashDigest")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Request and check an STM32WBAxx flash digest")
+    parser.add_argument("image", help="raw image programmed at --base")
+    parser.add_argument("--base", type=lambda x: int(x, 0), default=0x08000000,
+                        help="flash address of the image (default: 0x08000000)")
+    parser.add_argument("--range", type=parse_range, action="append", dest="ranges",
+                        metavar="ADR:SIZE", help="flash range to hash, repeat for more")
+    parser.add_argument("--request", help="write struct FlashDigest for the target")
+    parser.add_argument("--check", help="digest read back from the target (file or hex)")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as f:
+        image = f.read()
+    ranges = args.ranges or [(args.base, len(image))]
+    for adr, size in ranges:
+        if size < 0 or adr < 0 or adr + size > 0x100000000:
+            print(f"error: range 0x{adr:08X}:0x{size:X} is not in the address space", file=sys.stderr)
+            return 1
+    ref = hashlib.sha256(message(image, args.base, ranges)).digest()
+
+    if args.request:
+        with open(args.request, "wb") as f:
+            f.write(request(ranges))
+    print(f"{len(ranges)} ranges, {sum(s for _, s in ranges)} bytes, sha256 {ref.hex()}")
+
+    if args.check:
+        try:
+            engine, digest = result(args.check)
+        except ValueError as e:
+            print(f"error: {e}", file=sys.stderr)
+            return 1
+        if engine is not None:
+            print(f"target engine: {ENGINES.get(engine, f'unknown ({engine})')}")
+        if digest != ref:
+            print(f"error: target digest {digest.hex()} does not match", file=sys.stderr)
+            return 1
+        print("target digest matches")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 ARM Ltd.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Expand the compressed flash readback produced by the Readback entry point
+# of the STM32WBAxx flash algorithm (see STM32WBAxx/FlashExt.h).
+#
+# The host stores the rb->outSz bytes of every Readback call in one file in
+# call order. This tool expands that file to the raw flash image:
+#
+#   flash_readback.py dump.rbz dump.bin [--size <bytes>]
+# -----------------------------------------------------------------------------
+
+import argparse
+import sys
+
+RB_MATCH_MIN = 4
+
+
+def expand(data):
+    """Expand a readback stream (bytes) and return the flash image (bytearray)."""
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        t = data[i]
+        i += 1
+        if t < 0x80:                                  # literal
+            cnt = t + 1
+            if i + cnt > n:
+                raise ValueError(f"truncated literal at offset {i - 1}")
+            out += data[i:i + cnt]
+            i += cnt
+        elif t < 0xC0:                                # erased run
+            if i + 1 > n:
+                raise ValueError(f"truncated erased run at offset {i - 1}")
+            out += b"\xFF" * ((((t & 0x3F) << 8) | data[i]) + 1)
+            i += 1
+        else:                                         # match
+            if i + 2 > n:
+                raise ValueError(f"truncated match at offset {i - 1}")
+            cnt = (t & 0x3F) + RB_MATCH_MIN
+            offs = data[i] | (data[i + 1] << 8)
+            i += 2
+            if offs == 0 or offs > len(out):
+                raise ValueError(f"invalid match offset {offs} at offset {i - 3}")
+            src = len(out) - offs
+            for k in range(cnt):                      # may overlap the output
+                out.append(out[src + k])
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Expand a compressed STM32WBAxx flash readback")
+    parser.add_argument("input", help="concatenated Readback output chunks")
+    parser.add_argument("output", help="raw flash image to write")
+    parser.add_argument("--size", type=lambda x: int(x, 0),
+                        help="expected image size in bytes (readback end - base)")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    try:
+        image = expand(data)
+    except ValueError as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 1
+    if args.size is not None and len(image) != args.size:
+        print(f"error: expanded {len(image)} bytes, expected {args.size}", file=sys.stderr)
+        return 1
+    with open(args.output, "wb") as f:
+        f.write(image)
+    print(f"{len(data)} -> {len(image)} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
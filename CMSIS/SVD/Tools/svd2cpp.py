@@ -0,0 +1,286 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 ARM Ltd.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generate header-only C++17 register definitions from CMSIS-SVD files.
+#
+# Every <device>.svd becomes <device>.hpp with one namespace per peripheral
+# (lower case, so it does not collide with the CMSIS device header macros),
+# one type per register and field, and constants for the enumerated values.
+# Access templates are in svd_reg.hpp, which is copied next to the output:
+#
+#   svd2cpp.py ../STM32WBA50.svd -o ../Include
+#
+#   using namespace stm32wba50::flash;
+#   svd::modify(NSCR1::PER::set() | NSCR1::PNB::val(page));   // one RMW
+#
+# Each peripheral also gets a 'layout' struct with static assertions on
+# the register offsets and field masks.
+# -----------------------------------------------------------------------------
+
+import argparse
+import os
+import re
+import shutil
+import sys
+import xml.etree.ElementTree as ET
+
+ACCESS = {
+    "read-only":      "svd::access::read_only",
+    "write-only":     "svd::access::write_only",
+    "read-write":     "svd::access::read_write",
+    "writeOnce":      "svd::access::write_only",
+    "read-writeOnce": "svd::access::read_write",
+}
+
+# Member names of svd::reg / svd::field that generated names must not hide
+RESERVED = {"address", "bits", "mode", "reset", "type", "ref", "read", "write",
+            "pos", "width", "mask", "val", "set", "clear", "base", "layout", "regs"}
+
+KEYWORDS = {"and", "bitand", "bitor", "break", "case", "char", "class", "compl", "const",
+            "default", "delete", "do", "else", "enum", "false", "for", "if", "int",
+            "long", "new", "not", "or", "private", "public", "return", "short",
+            "signed", "static", "struct", "switch", "this", "true", "union",
+            "unsigned", "void", "volatile", "while", "xor"}
+
+
+def num(text):
+    """SVD scaled non-negative integer ('0x..', '#..', decimal)."""
+    text = text.strip().lower()
+    if text.startswith("#"):
+        return int(text[1:], 2)
+    return int(text, 0)
+
+
+def ident(name, taken=(), outer=None):
+    """C++ identifier for an SVD name, unique within taken."""
+    s = re.sub(r"[^0-9A-Za-z_]", "_", name)
+    if not s or s[0].isdigit():
+        s = "_" + s
+    if s in RESERVED or s in KEYWORDS or s == outer:
+        s += "_"
+    base, n = s, 1
+    while s in taken:
+        s = f"{base}_{n}"
+        n += 1
+    return s
+
+
+def comment(text, limit=100):
+    text = " ".join((text or "").split()).replace("*/", "* /")
+    return text if len(text) <= limit else text[:limit - 3].rstrip() + "..."
+
+
+class Field:
+    def __init__(self, node):
+        self.name = node.findtext("name")
+        self.desc = node.findtext("description")
+        if node.find("bitOffset") is not None:
+            self.pos = num(node.findtext("bitOffset"))
+            self.width = num(node.findtext("bitWidth") or "1")
+        elif node.find("lsb") is not None:
+            self.pos = num(node.findtext("lsb"))
+            self.width = num(node.findtext("msb")) - self.pos + 1
+        else:
+            msb, lsb = re.match(r"\[(\w+):(\w+)\]", node.findtext("bitRange")).groups()
+            self.pos = num(lsb)
+            self.width = num(msb) - self.pos + 1
+        self.enums = []
+        for ev in node.iter("enumeratedValue"):
+            value = ev.findtext("value")
+            if value is None or (value.strip().startswith("#") and "x" in value.lower()):
+                continue                              # default or don't care value
+            self.enums.append((ev.findtext("name"), num(value), ev.findtext("description")))
+
+    @property
+    def mask(self):
+        return ((1 << self.width) - 1) << self.pos
+
+
+class Register:
+    def __init__(self, node, prefix, defaults, name=None, offset=None):
+        self.name = name or node.findtext("name")
+        if prefix and self.name.startswith(prefix + "_"):
+            self.name = self.name[len(prefix) + 1:]
+        self.desc = node.findtext("description")
+        self.offset = offset if offset is not None else num(node.findtext("addressOffset"))
+        self.size = num(node.findtext("size") or defaults["size"])
+        self.access = node.findtext("access") or defaults["access"]
+        self.reset = num(node.findtext("resetValue") or defaults["reset"])
+        self.fields = [Field(f) for f in node.iter("field")]
+
+
+def registers(periph, prefix, defaults):
+    regs = []
+    block = periph.find("registers")
+    if block is None:
+        return regs
+    for node in block:
+        if node.tag == "cluster":
+            print(f"warning: {prefix}: cluster {node.findtext('name')} skipped", file=sys.stderr)
+            continue
+        if node.tag != "register":
+            continue
+        dim = node.findtext("dim")
+        if dim is None:
+            regs.append(Register(node, prefix, defaults))
+            continue
+        inc = num(node.findtext("dimIncrement"))
+        idx = node.findtext("dimIndex")
+        if idx and "-" in idx:
+            lo, hi = idx.split("-")
+            idx = [str(i) for i in range(int(lo), int(hi) + 1)]
+        elif idx:
+            idx = idx.split(",")
+        else:
+            idx = [str(i) for i in range(num(dim))]
+        name = node.findtext("name").replace("[%s]", "%s")
+        for i, sfx in enumerate(idx):
+            regs.append(Register(node, prefix, defaults, name.replace("%s", sfx),
+                                 num(node.findtext("addressOffset")) + i * inc))
+    return regs
+
+
+def gen_register(out, reg, rname, pname):
+    acc = ACCESS.get(reg.access, "svd::access::read_write")
+    out.append(f"  /* {reg.name}: {comment(reg.desc)} */")
+    out.append(f"  struct {rname} : svd::reg<base + 0x{reg.offset:03X}U, {reg.size}U, {acc}, "
+               f"0x{reg.reset:08X}U> {{")
+    fnames = []
+    taken = set()
+    for f in reg.fields:
+        fname = ident(f.name, taken, rname)
+        taken.add(fname)
+        fnames.append(fname)
+        if f.pos + f.width > reg.size:
+            raise ValueError(f"{pname}.{reg.name}.{f.name} exceeds the register size")
+        if not f.enums:
+            out.append(f"    using {fname} = svd::field<{rname}, {f.pos}U, {f.width}U>;"
+                       f"  // {comment(f.desc)}")
+            continue
+        out.append(f"    // {comment(f.desc)}")
+        out.append(f"    struct {fname} : svd::field<{rname}, {f.pos}U, {f.width}U> {{")
+        etaken = set()
+        for ename, value, edesc in f.enums:
+            e = ident(ename, etaken, fname)
+            etaken.add(e)
+            out.append(f"      static constexpr svd::value<{rname}> {e} = val(0x{value:X}U);"
+                       f"  // {comment(edesc)}")
+        out.append("    };")
+    out.append("  };")
+    overlap = 0
+    for f in reg.fields:
+        if overlap & f.mask:
+            break
+        overlap |= f.mask
+    else:
+        if fnames:
+            out.append(f"  static_assert(svd::disjoint<{', '.join(rname + '::' + n for n in fnames)}>(),")
+            out.append(f"                \"{pname} {reg.name}: fields overlap\");")
+    out.append("")
+
+
+def gen_layout(out, regs, names, pname):
+    out.append("  /* Register layout */")
+    out.append("  struct layout {")
+    pos, res, placed = 0, 0, []
+    for reg, rname in sorted(zip(regs, names), key=lambda x: x[0].offset):
+        if reg.offset < pos:
+            out.append(f"    // {reg.name} shares offset 0x{reg.offset:03X}")
+            continue
+        if reg.offset > pos:
+            out.append(f"    std::uint8_t reserved{res}[0x{reg.offset - pos:X}];")
+            res += 1
+        out.append(f"    volatile std::uint{reg.size}_t {rname};")
+        placed.append((reg, rname))
+        pos = reg.offset + reg.size // 8
+    out.append("  };")
+    for reg, rname in placed:
+        out.append(f"  static_assert(offsetof(layout, {rname}) == 0x{reg.offset:03X}U, "
+                   f"\"{pname} {reg.name}: offset\");")
+        out.append(f"  static_assert({rname}::address == base + offsetof(layout, {rname}), "
+                   f"\"{pname} {reg.name}: address\");")
+    out.append("")
+    out.append("  inline layout &regs () { return *reinterpret_cast<layout *>(base); }")
+
+
+def generate(svd_file, out_dir):
+    dev = ET.parse(svd_file).getroot()
+    device = dev.findtext("name")
+    ns = ident(device.lower())
+    guard = re.sub(r"\W", "_", device.upper()) + "_HPP"
+    dev_defaults = {
+        "size":   dev.findtext("size") or "32",
+        "access": dev.findtext("access") or "read-write",
+        "reset":  dev.findtext("resetValue") or "0",
+    }
+    periphs = {p.findtext("name"): p for p in dev.iter("peripheral")}
+
+    out = [
+        f"/* Generated by svd2cpp.py from {os.path.basename(svd_file)} - do not edit */",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+        "#include \"svd_reg.hpp\"",
+        "",
+        f"namespace {ns} {{",
+        "",
+    ]
+    taken = set()
+    for pname, periph in periphs.items():
+        src = periph
+        if periph.get("derivedFrom"):
+            src = periphs[periph.get("derivedFrom")]
+        defaults = {
+            "size":   src.findtext("size") or dev_defaults["size"],
+            "access": src.findtext("access") or dev_defaults["access"],
+            "reset":  src.findtext("resetValue") or dev_defaults["reset"],
+        }
+        regs = registers(src, src.findtext("name"), defaults)
+        pns = ident(pname.lower(), taken)
+        taken.add(pns)
+        desc = periph.findtext("description") or src.findtext("description")
+        out.append(f"/* {pname}: {comment(desc)} */")
+        out.append(f"namespace {pns} {{")
+        out.append(f"  constexpr std::uintptr_t base = 0x{num(periph.findtext('baseAddress')):08X}U;")
+        out.append("")
+        names, rtaken = [], set()
+        for reg in regs:
+            rname = ident(reg.name, rtaken)
+            rtaken.add(rname)
+            names.append(rname)
+            gen_register(out, reg, rname, pname)
+        gen_layout(out, regs, names, pname)
+        out.append(f"}} // namespace {pns}")
+        out.append("")
+    out.append(f"}} // namespace {ns}")
+    out.append("")
+    out.append(f"#endif /* {guard} */")
+
+    path = os.path.join(out_dir, device + ".hpp")
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+    return path
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate C++ register definitions from SVD files")
+    parser.add_argument("svd", nargs="+", help="SVD files")
+    parser.add_argument("-o", "--output", default=".", help="output directory")
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    shutil.copy(os.path.join(os.path.dirname(os.path.abspath(__file__)), "svd_reg.hpp"), args.output)
+    for svd_file in args.svd:
+        print(generate(svd_file, args.output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
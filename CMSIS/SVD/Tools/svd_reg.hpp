@@ -0,0 +1,120 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Register access templates for headers generated by svd2cpp.py
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Registers and fields are types; addresses, masks and shifts are
+   constexpr, so accesses compile to the same instructions as hand-written
+   code. Field values of one register are combined with '|' at compile time
+   and applied with a single access:
+     svd::write (v)   write v, all other bits from the reset value
+     svd::modify(v)   one read-modify-write of the fields in v
+   Combining values of different registers does not compile.  */
+
+#ifndef SVD_REG_HPP
+#define SVD_REG_HPP
+
+#include <cstdint>
+#include <initializer_list>
+
+namespace svd {
+
+enum class access { read_only, write_only, read_write };
+
+/* Unsigned type of a register with Bits bits */
+template <unsigned Bits> struct reg_type;
+template <> struct reg_type< 8> { using type = std::uint8_t;  };
+template <> struct reg_type<16> { using type = std::uint16_t; };
+template <> struct reg_type<32> { using type = std::uint32_t; };
+
+/* Value of one or more fields of register Reg */
+template <class Reg>
+struct value {
+  std::uint32_t mask;                   // bits written
+  std::uint32_t bits;                   // new contents of the masked bits
+};
+
+template <class Reg>
+constexpr value<Reg> operator| (value<Reg> a, value<Reg> b) {
+  return value<Reg>{ a.mask | b.mask, (a.bits & ~b.mask) | b.bits };
+}
+
+/* Register at Address */
+template <std::uintptr_t Address, unsigned Bits, access Access, std::uint32_t Reset>
+struct reg {
+  using type = typename reg_type<Bits>::type;
+
+  static constexpr std::uintptr_t address = Address;
+  static constexpr unsigned       bits    = Bits;
+  static constexpr access         mode    = Access;
+  static constexpr type           reset   = static_cast<type>(Reset);
+
+  static volatile type &ref () {
+    return *reinterpret_cast<volatile type *>(Address);
+  }
+
+  static type read () {
+    static_assert(Access != access::write_only, "register is write-only");
+    return ref();
+  }
+
+  static void write (type v) {
+    static_assert(Access != access::read_only, "register is read-only");
+    ref() = v;
+  }
+};
+
+/* Field of register Reg at bit Pos with Width bits */
+template <class Reg, unsigned Pos, unsigned Width>
+struct field {
+  static_assert((Width != 0U) && ((Pos + Width) <= 32U), "field outside of the register");
+
+  static constexpr unsigned      pos   = Pos;
+  static constexpr unsigned      width = Width;
+  static constexpr std::uint32_t mask  = ((Width == 32U) ? 0xFFFFFFFFU : ((1UL << Width) - 1U)) << Pos;
+
+  static constexpr value<Reg> val (std::uint32_t v) {
+    return value<Reg>{ mask, (v << Pos) & mask };
+  }
+  static constexpr value<Reg> set ()   { return val(0xFFFFFFFFU); }
+  static constexpr value<Reg> clear () { return val(0U); }
+
+  static std::uint32_t read () {
+    return (static_cast<std::uint32_t>(Reg::read()) & mask) >> Pos;
+  }
+};
+
+/* Write the fields of v, the other bits get their reset value */
+template <class Reg>
+inline void write (value<Reg> v) {
+  Reg::write(static_cast<typename Reg::type>((Reg::reset & ~v.mask) | v.bits));
+}
+
+/* Change only the fields of v with one read and one write */
+template <class Reg>
+inline void modify (value<Reg> v) {
+  Reg::write(static_cast<typename Reg::type>((Reg::read() & ~v.mask) | v.bits));
+}
+
+/* True when no two of the fields share a bit */
+template <class... Fields>
+constexpr bool disjoint () {
+  std::uint32_t used = 0U;
+  bool          ok   = true;
+  for (std::uint32_t m : { 0U, Fields::mask... }) {
+    ok    = ok && ((used & m) == 0U);
+    used |= m;
+  }
+  return ok;
+}
+
+} // namespace svd
+
+#endif /* SVD_REG_HPP */
@@ -0,0 +1,211 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Boot-time image check for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/* Note:
+   The CRC unit uses the reset polynomial 0x04C11DB7 with initial value
+   0xFFFFFFFF. Words are written with bit reversal by word (REV_IN = 11),
+   which feeds the bytes of a little endian word in memory order with the
+   least significant bit first; a remaining tail is written byte by byte
+   with bit reversal by byte (REV_IN = 01). The output is bit reversed and
+   inverted in software, so the result equals zlib crc32().
+   The CRC and GPDMA1 clocks are restored when the computation ends.  */
+
+#include <stddef.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "BootCheck.h"
+#include "BootCheck_Config.h"
+
+// CRC Control Register definition
+#define BC_CRC_RESET      (1UL << 0)
+#define BC_CRC_REV_IN_B   (1UL << 5)    // bit reversal by byte
+#define BC_CRC_REV_IN_W   (3UL << 5)    // bit reversal by word
+#define BC_CRC_REV_OUT    (1UL << 7)
+
+#define BC_CRC_POLY       0x04C11DB7U
+#define BC_CRC_INIT       0xFFFFFFFFU
+
+// GPDMA Channel Register definition
+#define BC_DMA_EN         (1UL <<  0)   // CCR
+#define BC_DMA_SDW_WORD   (2UL <<  0)   // CTR1
+#define BC_DMA_SINC       (1UL <<  3)
+#define BC_DMA_SSEC       (1UL << 15)
+#define BC_DMA_DDW_WORD   (2UL << 16)
+#define BC_DMA_DSEC       (1UL << 31)
+#define BC_DMA_SWREQ      (1UL <<  9)   // CTR2
+#define BC_DMA_TCF        (1UL <<  8)   // CSR, CFCR
+#define BC_DMA_ERR        ((1UL << 16) | (1UL << 17) | (1UL << 18))
+#define BC_DMA_FLAGS      (0x7FUL << 8)
+
+#define BC_DMA_BLOCK_MAX  0xFFFCU       // BNDT is 16 bits, multiple of 4
+
+#if (BOOTCHECK_DMA != 0)
+#define BC_DMA_CH         ((DMA_Channel_TypeDef *)((uint32_t)GPDMA1_Channel0 + \
+                                                   (BOOTCHECK_DMA_CHANNEL * 0x80U)))
+#endif
+
+typedef struct {
+  uint32_t addr;
+  uint32_t size;
+  uint32_t crc;
+} BC_Region_t;
+
+typedef struct {
+  uint32_t    magic;
+  uint32_t    count;
+  BC_Region_t region[BOOTCHECK_REGION_MAX];
+  uint32_t    crc;
+} BC_Table_t;
+
+/* Checksum table, filled in after the build by bootcheck.py. Read through
+   a volatile pointer, the compiler must not use the initial values. */
+__USED const BC_Table_t BootCheck_Table = { 0xFFFFFFFFU, 0U, { { 0U, 0U, 0U } }, 0U };
+
+#if (BOOTCHECK_DMA != 0)
+/* Feed size bytes (multiple of 4) from data to the CRC unit with GPDMA1 */
+static int32_t CrcFeedDMA (const uint32_t *data, uint32_t size) {
+  uint32_t n, sr;
+
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  GPDMA1->SECCFGR |= (1UL << BOOTCHECK_DMA_CHANNEL);
+  BC_DMA_CH->CTR1  = BC_DMA_SDW_WORD | BC_DMA_SINC | BC_DMA_SSEC | BC_DMA_DDW_WORD | BC_DMA_DSEC;
+#else
+  BC_DMA_CH->CTR1  = BC_DMA_SDW_WORD | BC_DMA_SINC | BC_DMA_DDW_WORD;
+#endif
+  BC_DMA_CH->CTR2  = BC_DMA_SWREQ;
+  BC_DMA_CH->CLLR  = 0U;
+  BC_DMA_CH->CDAR  = (uint32_t)&CRC->DR;
+
+  while (size != 0U) {
+    n = (size > BC_DMA_BLOCK_MAX) ? BC_DMA_BLOCK_MAX : size;
+
+    BC_DMA_CH->CFCR = BC_DMA_FLAGS;
+    BC_DMA_CH->CSAR = (uint32_t)data;
+    BC_DMA_CH->CBR1 = n;
+    BC_DMA_CH->CCR  = BC_DMA_EN;
+    do {
+      sr = BC_DMA_CH->CSR;
+    } while ((sr & (BC_DMA_TCF | BC_DMA_ERR)) == 0U);
+    BC_DMA_CH->CFCR = BC_DMA_FLAGS;
+    if ((sr & BC_DMA_ERR) != 0U) {
+      BC_DMA_CH->CCR = 0U;
+      return BOOTCHECK_ERROR_DMA;
+    }
+
+    data += n / 4U;
+    size -= n;
+  }
+  return BOOTCHECK_OK;
+}
+#else
+/* Feed size bytes (multiple of 4) from data to the CRC unit */
+static int32_t CrcFeedCPU (const uint32_t *data, uint32_t size) {
+  volatile uint32_t *dr = &CRC->DR;
+
+  for (; size >= 16U; size -= 16U) {
+    *dr = data[0];
+    *dr = data[1];
+    *dr = data[2];
+    *dr = data[3];
+    data += 4;
+  }
+  for (; size != 0U; size -= 4U) {
+    *dr = *data++;
+  }
+  return BOOTCHECK_OK;
+}
+#endif
+
+int32_t BootCheck_Crc (const void *data, uint32_t size, uint32_t *crc) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t       ahb1enr, n;
+  int32_t        status;
+
+  ahb1enr = RCC->AHB1ENR;
+#if (BOOTCHECK_DMA != 0)
+  RCC->AHB1ENR = ahb1enr | RCC_AHB1ENR_CRCEN | RCC_AHB1ENR_GPDMA1EN;
+#else
+  RCC->AHB1ENR = ahb1enr | RCC_AHB1ENR_CRCEN;
+#endif
+  (void)RCC->AHB1ENR;                   // Clock enable delay
+
+  CRC->POL  = BC_CRC_POLY;
+  CRC->INIT = BC_CRC_INIT;
+  CRC->CR   = BC_CRC_REV_IN_W | BC_CRC_REV_OUT | BC_CRC_RESET;
+
+  // Unaligned head byte by byte
+  if (((uint32_t)p & 3U) != 0U) {
+    CRC->CR = BC_CRC_REV_IN_B | BC_CRC_REV_OUT;
+    while ((size != 0U) && (((uint32_t)p & 3U) != 0U)) {
+      *((volatile uint8_t *)&CRC->DR) = *p++;
+      size--;
+    }
+    CRC->CR = BC_CRC_REV_IN_W | BC_CRC_REV_OUT;
+  }
+
+  n = size & ~3U;
+#if (BOOTCHECK_DMA != 0)
+  status = CrcFeedDMA((const uint32_t *)p, n);
+#else
+  status = CrcFeedCPU((const uint32_t *)p, n);
+#endif
+  p    += n;
+  size -= n;
+
+  // Tail byte by byte
+  if (size != 0U) {
+    CRC->CR = BC_CRC_REV_IN_B | BC_CRC_REV_OUT;
+    while (size != 0U) {
+      *((volatile uint8_t *)&CRC->DR) = *p++;
+      size--;
+    }
+  }
+
+  *crc = ~CRC->DR;
+  RCC->AHB1ENR = ahb1enr;
+
+  return status;
+}
+
+int32_t BootCheck_Verify (void) {
+  const volatile BC_Table_t *tbl = &BootCheck_Table;
+  uint32_t i, crc;
+  int32_t  status;
+
+  if ((tbl->magic != BOOTCHECK_MAGIC) || (tbl->count > BOOTCHECK_REGION_MAX)) {
+    return BOOTCHECK_ERROR_TABLE;
+  }
+  status = BootCheck_Crc((const void *)tbl, offsetof(BC_Table_t, crc), &crc);
+  if (status != BOOTCHECK_OK) {
+    return status;
+  }
+  if (crc != tbl->crc) {
+    return BOOTCHECK_ERROR_TABLE;
+  }
+
+  for (i = 0U; i < tbl->count; i++) {
+    status = BootCheck_Crc((const void *)tbl->region[i].addr, tbl->region[i].size, &crc);
+    if (status != BOOTCHECK_OK) {
+      return status;
+    }
+    if (crc != tbl->region[i].crc) {
+      return BOOTCHECK_ERROR_CRC;
+    }
+  }
+  return BOOTCHECK_OK;
+}
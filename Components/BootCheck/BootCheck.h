@@ -0,0 +1,59 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Boot-time image check for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   BootCheck_Verify computes the CRC-32 (zlib/IEEE 802.3) of every region
+   listed in the checksum table BootCheck_Table with the CRC unit and
+   compares it with the stored value. The table is placed in flash by the
+   linker and filled in after the build by Tools/bootcheck.py, which takes
+   the regions from the load segments of the image and the Flash_NS/Flash_S
+   memories of the device in the pdsc:
+
+     bootcheck.py out/Project.axf --device STM32WBA52CGUx --hex out/Project.hex
+
+   Table layout (32-bit little endian words):
+     magic                  BOOTCHECK_MAGIC
+     count                  number of regions used
+     addr, size, crc        BOOTCHECK_REGION_MAX entries, 4-byte aligned
+     crc                    CRC-32 of all words above  */
+
+#ifndef BOOTCHECK_H
+#define BOOTCHECK_H
+
+#include <stdint.h>
+
+// Status codes
+#define BOOTCHECK_OK                    0       // All regions match
+#define BOOTCHECK_ERROR_TABLE          -1       // Table not filled in or corrupted
+#define BOOTCHECK_ERROR_CRC            -2       // Region checksum mismatch
+#define BOOTCHECK_ERROR_DMA            -3       // GPDMA transfer error
+
+// Table signature written by bootcheck.py
+#define BOOTCHECK_MAGIC                 0x4B434842U     // "BHCK"
+
+/**
+  \fn          int32_t BootCheck_Verify (void)
+  \brief       Check all regions of the checksum table.
+  \return      BOOTCHECK_OK or status code
+*/
+extern int32_t BootCheck_Verify (void);
+
+/**
+  \fn          int32_t BootCheck_Crc (const void *data, uint32_t size, uint32_t *crc)
+  \brief       Compute the CRC-32 of a memory block with the CRC unit.
+  \param[in]   data  start address
+  \param[in]   size  number of bytes
+  \param[out]  crc   CRC-32, same value as zlib crc32()
+  \return      BOOTCHECK_OK or BOOTCHECK_ERROR_DMA
+*/
+extern int32_t BootCheck_Crc (const void *data, uint32_t size, uint32_t *crc);
+
+#endif /* BOOTCHECK_H */
@@ -0,0 +1,35 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Boot-time image check configuration for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <h>Boot Check
+
+//   <o>Maximum Number of Regions <1-16>
+//   <i>Entries of the checksum table filled in by Tools/bootcheck.py.
+//   <i>The image needs one region per contiguous part in Flash_NS or
+//   <i>Flash_S, plus one because the table itself is excluded.
+#define BOOTCHECK_REGION_MAX    4
+
+//   <e>Use GPDMA
+//   <i>Feed the CRC unit with a GPDMA1 memory-to-peripheral transfer
+//   <i>instead of CPU loads and stores.
+#define BOOTCHECK_DMA           0
+
+//     <o>GPDMA1 Channel <0-7>
+//     <i>Channel used during BootCheck_Verify and BootCheck_Crc only.
+#define BOOTCHECK_DMA_CHANNEL   7
+
+//   </e>
+
+// </h>
+
+//------------- <<< end of configuration section >>> ---------------------------
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Copyright (c) 2026 ARM Ltd.
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Fill in the checksum table of the Device:Flash:Boot Check component.
+#
+# The regions are the load segments of the image that are in the flash
+# memories of the device in the pdsc (Flash_NS/Flash_S, or Flash). Segments
+# in the same flash page are merged, because the programmer erases those
+# pages completely; the table itself is cut out. The CRC-32 of each region
+# is stored in the symbol BootCheck_Table, and the ELF file is updated in
+# place. Run it as post-build step, for example in the cproject.yml:
+#
+#   executes:
+#     - execute: Boot Check
+#       run: python3 $input(0)$ $input(1)$ --device $Dname$ --hex $output$
+#       input:
+#         - $Pack(Keil::STM32WBAxx_DFP)$/Components/BootCheck/Tools/bootcheck.py
+#         - $elf()$
+#       output:
+#         - $hex()$
+#
+# Options --hex and --bin write the patched flash contents again, as the
+# output files of the linker no longer match the ELF file.
+# -----------------------------------------------------------------------------
+
+import argparse
+import glob
+import os
+import struct
+import sys
+import xml.etree.ElementTree as ET
+import zlib
+
+MAGIC = 0x4B434842          # BOOTCHECK_MAGIC
+SYMBOL = "BootCheck_Table"
+PAGE = 0x2000
+ERASED = 0xFF
+
+PT_LOAD = 1
+SHT_SYMTAB = 2
+
+
+class Elf:
+    """Little endian ELF32 file with load segments and symbols."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = bytearray(f.read())
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError(f"{path}: not a little endian ELF32 file")
+        (phoff, shoff, _, _, phentsize, phnum,
+         shentsize, shnum, _) = struct.unpack_from("<IIIHHHHHH", self.data, 28)
+        self.segments = []
+        for i in range(phnum):
+            p = struct.unpack_from("<IIIIIIII", self.data, phoff + i * phentsize)
+            if p[0] == PT_LOAD and p[4] != 0:
+                self.segments.append({"offset": p[1], "vaddr": p[2], "paddr": p[3], "size": p[4]})
+        self.sections = [struct.unpack_from("<IIIIIIIIII", self.data, shoff + i * shentsize)
+                         for i in range(shnum)]
+
+    def symbol(self, name):
+        """(address, size) of a symbol."""
+        for sh in self.sections:
+            if sh[1] != SHT_SYMTAB:
+                continue
+            strtab = self.sections[sh[6]]
+            for pos in range(sh[4], sh[4] + sh[5], 16):
+                st_name, value, size = struct.unpack_from("<III", self.data, pos)
+                end = self.data.index(b"\0", strtab[4] + st_name)
+                if self.data[strtab[4] + st_name:end].decode() == name:
+                    return value, size
+        raise KeyError(f"symbol {name} not found, is the Boot Check component selected?")
+
+    def locate(self, vaddr, size):
+        """(file offset, load address) of an object at vaddr."""
+        for seg in self.segments:
+            if seg["vaddr"] <= vaddr and vaddr + size <= seg["vaddr"] + seg["size"]:
+                return seg["offset"] + vaddr - seg["vaddr"], seg["paddr"] + vaddr - seg["vaddr"]
+        raise ValueError(f"0x{vaddr:08X} is not in a load segment")
+
+    def load(self):
+        """List of (load address, bytes) of all load segments."""
+        return [(seg["paddr"], self.data[seg["offset"]:seg["offset"] + seg["size"]])
+                for seg in self.segments]
+
+
+def flash_memories(pdsc, device):
+    """Flash memories (name, start, size) of a device in the pdsc."""
+    root = ET.parse(pdsc).getroot()
+
+    def walk(node, inherited):
+        mem = inherited + node.findall("memory")
+        for child in node:
+            if child.tag in ("family", "subFamily", "device", "variant"):
+                name = child.get("Dname") or child.get("Dvariant")
+                if child.tag in ("device", "variant") and name == device:
+                    return mem + child.findall("memory")
+                found = walk(child, mem)
+                if found is not None:
+                    return found
+        return None
+
+    mem = walk(root.find("devices"), [])
+    if mem is None:
+        raise KeyError(f"device {device} not found in {pdsc}")
+    return [(m.get("name"), int(m.get("start"), 0), int(m.get("size"), 0))
+            for m in mem if m.get("name").startswith("Flash") and "x" in m.get("access", "")]
+
+
+def regions(image, flash, table, table_size):
+    """Regions (addr, size) covering the image in flash, without the table."""
+    spans = []
+    for addr, data in sorted(image):
+        mem = [m for m in flash if m[1] <= addr and addr + len(data) <= m[1] + m[2]]
+        if not mem:
+            print(f"warning: segment 0x{addr:08X}..0x{addr + len(data) - 1:08X} "
+                  f"is not in flash, skipped", file=sys.stderr)
+            continue
+        start, end = addr & ~3, (addr + len(data) + 3) & ~3
+        if spans and spans[-1][2] == mem[0][0] and start <= (spans[-1][1] + PAGE - 1) // PAGE * PAGE:
+            spans[-1][1] = max(spans[-1][1], end)
+        else:
+            spans.append([start, end, mem[0][0]])
+    out = []
+    for start, end, _ in spans:
+        if start <= table < end:
+            out += [(start, table - start), (table + table_size, end - table - table_size)]
+        else:
+            out.append((start, end - start))
+    return [r for r in out if r[1] > 0]
+
+
+def read(image, addr, size):
+    """Flash contents, erased where the image has no data."""
+    buf = bytearray([ERASED]) * size
+    for seg_addr, data in image:
+        lo, hi = max(addr, seg_addr), min(addr + size, seg_addr + len(data))
+        if lo < hi:
+            buf[lo - addr:hi - addr] = data[lo - seg_addr:hi - seg_addr]
+    return bytes(buf)
+
+
+def write_hex(path, image):
+    def record(addr, rtype, data):
+        rec = struct.pack(">BHB", len(data), addr, rtype) + data
+        return ":" + rec.hex().upper() + f"{-sum(rec) & 0xFF:02X}"
+
+    lines, upper = [], None
+    for addr, data in sorted(image):
+        pos = 0
+        while pos < len(data):
+            a = addr + pos
+            if a >> 16 != upper:
+                upper = a >> 16
+                lines.append(record(0, 4, struct.pack(">H", upper)))
+            n = min(16, len(data) - pos, 0x10000 - (a & 0xFFFF))
+            lines.append(record(a & 0xFFFF, 0, bytes(data[pos:pos + n])))
+            pos += n
+    lines.append(record(0, 1, b""))
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    pack = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "..")
+    pdsc = sorted(glob.glob(os.path.join(pack, "*.pdsc")))
+    parser = argparse.ArgumentParser(description="Fill in the Boot Check table of an image")
+    parser.add_argument("elf", help="ELF image, updated in place")
+    parser.add_argument("--device", required=True, help="device name (Dname) in the pdsc")
+    parser.add_argument("--pdsc", default=pdsc[0] if pdsc else None,
+                        help="pack description (default: pdsc of this pack)")
+    parser.add_argument("--hex", help="write the flash contents as Intel HEX file")
+    parser.add_argument("--bin", help="write the flash contents as binary file")
+    args = parser.parse_args()
+    if args.pdsc is None:
+        parser.error("--pdsc is required")
+
+    elf = Elf(args.elf)
+    flash = flash_memories(args.pdsc, args.device)
+    vaddr, size = elf.symbol(SYMBOL)
+    max_regions = (size - 12) // 12
+    if size < 24 or size != 12 + 12 * max_regions:
+        print(f"error: {SYMBOL} has unexpected size {size}", file=sys.stderr)
+        return 1
+    offset, table = elf.locate(vaddr, size)
+
+    image = elf.load()
+    rlist = regions(image, flash, table, size)
+    if len(rlist) > max_regions:
+        print(f"error: {len(rlist)} regions, BOOTCHECK_REGION_MAX is {max_regions}", file=sys.stderr)
+        return 1
+
+    words = [MAGIC, len(rlist)]
+    for addr, rsize in rlist:
+        words += [addr, rsize, zlib.crc32(read(image, addr, rsize))]
+    words += [0] * (3 * (max_regions - len(rlist)))
+    body = struct.pack(f"<{len(words)}I", *words)
+    elf.data[offset:offset + size] = body + struct.pack("<I", zlib.crc32(body))
+    with open(args.elf, "wb") as f:
+        f.write(elf.data)
+
+    image = elf.load()
+    image = [(a, d) for a, d in image if any(m[1] <= a < m[1] + m[2] for m in flash)]
+    if args.hex:
+        write_hex(args.hex, image)
+    if args.bin:
+        lo = min(a for a, _ in image)
+        hi = max(a + len(d) for a, d in image)
+        with open(args.bin, "wb") as f:
+            f.write(read(image, lo, hi - lo))
+
+    print(f"{SYMBOL} at 0x{table:08X}:")
+    for i, (addr, rsize) in enumerate(rlist):
+        print(f"  0x{addr:08X} size 0x{rsize:08X} crc 0x{words[4 + 3 * i]:08X}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,32 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Asynchronous Flash driver configuration for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <h>Asynchronous Flash Driver
+
+//   <o>Request Queue Size <1-64>
+//   <i>Number of erase and program requests that can be pending.
+#define FLASH_ASYNC_QUEUE_SIZE  8
+
+//   <o>Interrupt Priority <0-15>
+//   <i>NVIC priority of the Flash interrupt. Callbacks run at this priority.
+#define FLASH_ASYNC_IRQ_PRIORITY 8
+
+//   <q>Provide Interrupt Handler
+//   <i>Define FLASH_IRQHandler (FLASH_S_IRQHandler in secure applications).
+//   <i>Disable when the handler is generated by CubeMX and call
+//   <i>FlashAsync_IRQHandler from it.
+#define FLASH_ASYNC_IRQ_HANDLER 1
+
+// </h>
+
+//------------- <<< end of configuration section >>> ---------------------------
@@ -0,0 +1,304 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Asynchronous Flash driver for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/* Note:
+   Register definitions, unlock sequence and bank/page computation follow
+   CMSIS/Flash/STM32WBAxx/FlashPrg.c. Secure applications use the secure
+   control and status registers and the FLASH_S interrupt, all others the
+   non-secure ones.
+   The flash page size is 8 KB, 4 KB on STM32WBA2x (as in FlashDev.c).
+   The head of the queue is the active request. A program request writes
+   one quad-word per end of operation interrupt. ICACHE is invalidated when
+   a request completes, so reads do not return data cached before it.  */
+
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "FlashAsync.h"
+#include "FlashAsync_Config.h"
+
+#define M32(adr)          (*((volatile uint32_t *) (adr)))
+
+// Flash Registers (FLASH_TypeDef of the device header)
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+#define FLASH_KEYR        FLASH->SECKEYR
+#define FLASH_SR          FLASH->SECSR
+#define FLASH_CR          FLASH->SECCR1
+#define FLASH_ASYNC_IRQn  FLASH_S_IRQn
+#define FLASH_ASYNC_IRQ   FLASH_S_IRQHandler
+#else
+#define FLASH_KEYR        FLASH->NSKEYR
+#define FLASH_SR          FLASH->NSSR
+#define FLASH_CR          FLASH->NSCR1
+#define FLASH_ASYNC_IRQn  FLASH_IRQn
+#define FLASH_ASYNC_IRQ   FLASH_IRQHandler
+#endif
+
+#define FLASHSIZE_BASE    (0x0BFA07A0)
+
+// Flash Keys
+#define FA_FLASH_KEY1     0x45670123U
+#define FA_FLASH_KEY2     0xCDEF89ABU
+
+// Flash Control Register definition
+#define FA_FLASH_PG       (1UL <<  0)
+#define FA_FLASH_PER      (1UL <<  1)
+#define FA_FLASH_PNB_Pos  3U
+#define FA_FLASH_BKER     (1UL << 11)
+#define FA_FLASH_STRT     (1UL << 16)
+#define FA_FLASH_EOPIE    (1UL << 24)
+#define FA_FLASH_ERRIE    (1UL << 25)
+#define FA_FLASH_LOCK     (1UL << 31)
+
+// Flash Status Register definition
+#define FA_FLASH_EOP      (1UL <<  0)
+#define FA_FLASH_BSY      (1UL << 16)
+#define FA_FLASH_ERR      ((1UL << 1) | (1UL << 3) | (1UL << 4) | (1UL << 5) | \
+                           (1UL << 6) | (1UL << 7))
+
+// Flash Option Register definition
+#define FA_FLASH_DUALBANK (1UL << 21)
+
+#if defined(FLASH_PAGE_SIZE)
+#define FA_PAGE_SIZE      FLASH_PAGE_SIZE       // device header
+#elif defined(STM32WBA23xx) || defined(STM32WBA25xx)
+#define FA_PAGE_SIZE      0x1000U
+#else
+#define FA_PAGE_SIZE      0x2000U
+#endif
+
+#define FA_OP_ERASE       1U
+#define FA_OP_PROGRAM     2U
+
+typedef struct {
+  uint8_t        op;                    // FA_OP_xxx
+  uint32_t       addr;                  // Start address
+  const uint8_t *data;                  // Program data
+  uint32_t       len;                   // Program length
+  uint32_t       done;                  // Bytes programmed
+} FA_Request_t;
+
+static FA_Request_t          fa_queue[FLASH_ASYNC_QUEUE_SIZE];
+static volatile uint32_t     fa_head;   // Active request
+static volatile uint32_t     fa_count;  // Queued requests
+static FlashAsync_Callback_t fa_cb_event;
+static uint8_t               fa_init;
+
+/* Flash size in bytes */
+static uint32_t FlashSize (void) {
+  return ((M32(FLASHSIZE_BASE) & 0xFFFFU) * 0x400U);
+}
+
+/* Dual-bank flash: not device 0x492, and 2MB or DUALBANK option set */
+static uint32_t FlashDualBank (void) {
+  if ((DBGMCU->IDCODE & 0xFFFU) == 0x492U) {
+    return 0U;
+  }
+  if ((FlashSize() < 0x200000U) && ((FLASH->OPTR & FA_FLASH_DUALBANK) == 0U)) {
+    return 0U;
+  }
+  return 1U;
+}
+
+/* Page erase control value for the page containing addr */
+static uint32_t ErasePage (uint32_t addr) {
+  uint32_t ofs, bank2;
+
+  ofs = addr & 0x03FFFFFFU;             // offset in 0x08000000 or 0x0C000000 alias
+
+  bank2 = 0U;
+  if (FlashDualBank() != 0U) {
+    if (ofs >= (FlashSize() / 2U)) {
+      ofs  -= FlashSize() / 2U;
+      bank2 = 1U;
+    }
+  }
+  return (FA_FLASH_PER | ((ofs / FA_PAGE_SIZE) << FA_FLASH_PNB_Pos) | (bank2 ? FA_FLASH_BKER : 0U));
+}
+
+/* Invalidate ICACHE after flash contents changed */
+static void CacheInvalidate (void) {
+
+  if ((ICACHE->CR & ICACHE_CR_EN) != 0U) {
+    ICACHE->CR |= ICACHE_CR_CACHEINV;
+    while ((ICACHE->SR & ICACHE_SR_BUSYF) != 0U);
+  }
+}
+
+/* Write the next quad-word of the active program request */
+static void ProgramNext (FA_Request_t *req) {
+  uint32_t qw[4];
+  uint32_t addr;
+
+  memcpy(qw, &req->data[req->done], sizeof(qw));
+  addr = req->addr + req->done;
+
+  M32(addr     ) = qw[0];
+  M32(addr +  4) = qw[1];
+  M32(addr +  8) = qw[2];
+  M32(addr + 12) = qw[3];
+}
+
+/* Start the active request (interrupts masked or in the Flash interrupt) */
+static void StartRequest (void) {
+  FA_Request_t *req = &fa_queue[fa_head];
+
+  if ((FLASH_CR & FA_FLASH_LOCK) != 0U) {
+    FLASH_KEYR = FA_FLASH_KEY1;
+    FLASH_KEYR = FA_FLASH_KEY2;
+  }
+  FLASH_SR = FA_FLASH_EOP | FA_FLASH_ERR;   // Reset Flags
+
+  if (req->op == FA_OP_ERASE) {
+    FLASH_CR  = ErasePage(req->addr) | FA_FLASH_EOPIE | FA_FLASH_ERRIE;
+    FLASH_CR |= FA_FLASH_STRT;
+  } else {
+    FLASH_CR  = FA_FLASH_PG | FA_FLASH_EOPIE | FA_FLASH_ERRIE;
+    ProgramNext(req);
+  }
+}
+
+/* Add a request to the queue and start it when the driver is idle */
+static int32_t Enqueue (uint8_t op, uint32_t addr, const uint8_t *data, uint32_t len) {
+  FA_Request_t *req;
+  uint32_t      primask;
+  int32_t       status;
+
+  if (fa_init == 0U) {
+    return FLASH_ASYNC_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (fa_count == FLASH_ASYNC_QUEUE_SIZE) {
+    status = FLASH_ASYNC_ERROR_BUSY;
+  } else {
+    req       = &fa_queue[(fa_head + fa_count) % FLASH_ASYNC_QUEUE_SIZE];
+    req->op   = op;
+    req->addr = addr;
+    req->data = data;
+    req->len  = len;
+    req->done = 0U;
+    fa_count++;
+    if (fa_count == 1U) {
+      StartRequest();
+    }
+    status = FLASH_ASYNC_OK;
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+int32_t FlashAsync_Initialize (FlashAsync_Callback_t cb_event) {
+
+  fa_cb_event = cb_event;
+  fa_head     = 0U;
+  fa_count    = 0U;
+
+  while (FLASH_SR & FA_FLASH_BSY);
+  FLASH_SR = FA_FLASH_EOP | FA_FLASH_ERR;   // Reset Flags
+
+  NVIC_SetPriority(FLASH_ASYNC_IRQn, FLASH_ASYNC_IRQ_PRIORITY);
+  NVIC_ClearPendingIRQ(FLASH_ASYNC_IRQn);
+  NVIC_EnableIRQ(FLASH_ASYNC_IRQn);
+
+  fa_init = 1U;
+  return FLASH_ASYNC_OK;
+}
+
+int32_t FlashAsync_Uninitialize (void) {
+
+  if (fa_init == 0U) {
+    return FLASH_ASYNC_ERROR;
+  }
+  if (fa_count != 0U) {
+    return FLASH_ASYNC_ERROR_BUSY;      // Called again when GetPending returns 0
+  }
+
+  NVIC_DisableIRQ(FLASH_ASYNC_IRQn);
+  FLASH_CR = FA_FLASH_LOCK;
+
+  fa_init = 0U;
+  return FLASH_ASYNC_OK;
+}
+
+int32_t FlashAsync_Erase (uint32_t addr) {
+  return Enqueue(FA_OP_ERASE, addr, NULL, 0U);
+}
+
+int32_t FlashAsync_Program (uint32_t addr, const void *data, uint32_t len) {
+
+  if ((data == NULL) || (len == 0U) ||
+      ((addr & (FLASH_ASYNC_PROGRAM_UNIT - 1U)) != 0U) ||
+      ((len  & (FLASH_ASYNC_PROGRAM_UNIT - 1U)) != 0U)) {
+    return FLASH_ASYNC_ERROR_PARAMETER;
+  }
+  return Enqueue(FA_OP_PROGRAM, addr, (const uint8_t *)data, len);
+}
+
+uint32_t FlashAsync_GetPending (void) {
+  return fa_count;
+}
+
+void FlashAsync_IRQHandler (void) {
+  FA_Request_t *req;
+  uint32_t      sr, event, addr;
+
+  sr = FLASH_SR;
+  if ((fa_count == 0U) || ((sr & (FA_FLASH_EOP | FA_FLASH_ERR)) == 0U)) {
+    return;                             // ECC or spurious interrupt
+  }
+  FLASH_SR = sr & (FA_FLASH_EOP | FA_FLASH_ERR);
+
+  req = &fa_queue[fa_head];
+  if ((sr & FA_FLASH_ERR) != 0U) {
+    event = FLASH_ASYNC_EVENT_ERROR;
+  } else if (req->op == FA_OP_ERASE) {
+    event = FLASH_ASYNC_EVENT_ERASE_DONE;
+  } else {
+    req->done += FLASH_ASYNC_PROGRAM_UNIT;
+    if (req->done < req->len) {
+      ProgramNext(req);
+      return;
+    }
+    event = FLASH_ASYNC_EVENT_PROGRAM_DONE;
+  }
+  addr = req->addr;
+  CacheInvalidate();
+
+  FLASH_CR = 0U;                        // Reset PG/PER/PNB and interrupt enables
+  fa_head  = (fa_head + 1U) % FLASH_ASYNC_QUEUE_SIZE;
+  fa_count--;
+  if (fa_count != 0U) {
+    StartRequest();
+  } else {
+    FLASH_CR = FA_FLASH_LOCK;
+  }
+
+  if (fa_cb_event != NULL) {
+    fa_cb_event(event, addr);
+  }
+}
+
+#if (FLASH_ASYNC_IRQ_HANDLER != 0)
+void FLASH_ASYNC_IRQ (void);
+void FLASH_ASYNC_IRQ (void) {
+  FlashAsync_IRQHandler();
+}
+#endif
@@ -0,0 +1,93 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Asynchronous Flash driver for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Erase and program requests are queued and return immediately. The
+   operations run from the Flash interrupt (EOPIE/ERRIE) and the callback
+   reports the completion of each request from interrupt context.
+   Code fetches and data reads from the bank being erased or programmed are
+   stalled by the Flash controller until the operation ends; time critical
+   code of a single-bank device should run from SRAM.  */
+
+#ifndef FLASH_ASYNC_H
+#define FLASH_ASYNC_H
+
+#include <stdint.h>
+
+// Status codes
+#define FLASH_ASYNC_OK                  0       // Request accepted
+#define FLASH_ASYNC_ERROR              -1       // Driver not initialized
+#define FLASH_ASYNC_ERROR_BUSY         -2       // Request queue full, or requests pending
+#define FLASH_ASYNC_ERROR_PARAMETER    -3       // Invalid parameter
+
+// Callback events
+#define FLASH_ASYNC_EVENT_ERASE_DONE    (1UL << 0)  // Page erase completed
+#define FLASH_ASYNC_EVENT_PROGRAM_DONE  (1UL << 1)  // Program request completed
+#define FLASH_ASYNC_EVENT_ERROR         (1UL << 2)  // Operation failed
+
+// Program granularity in bytes (quad-word)
+#define FLASH_ASYNC_PROGRAM_UNIT        16U
+
+/**
+  \fn          void FlashAsync_Callback_t (uint32_t event, uint32_t addr)
+  \brief       Signal the completion of a request (called from the interrupt).
+  \param[in]   event  FLASH_ASYNC_EVENT_xxx
+  \param[in]   addr   start address of the request
+*/
+typedef void (*FlashAsync_Callback_t) (uint32_t event, uint32_t addr);
+
+/**
+  \fn          int32_t FlashAsync_Initialize (FlashAsync_Callback_t cb_event)
+  \brief       Initialize the driver and enable the Flash interrupt.
+  \param[in]   cb_event  callback, may be NULL
+  \return      FLASH_ASYNC_OK or status code
+*/
+extern int32_t FlashAsync_Initialize (FlashAsync_Callback_t cb_event);
+
+/**
+  \fn          int32_t FlashAsync_Uninitialize (void)
+  \brief       Disable the interrupt and lock the Flash when no request is pending.
+  \return      FLASH_ASYNC_OK, FLASH_ASYNC_ERROR_BUSY while requests are pending, or status code
+*/
+extern int32_t FlashAsync_Uninitialize (void);
+
+/**
+  \fn          int32_t FlashAsync_Erase (uint32_t addr)
+  \brief       Queue the erase of the page containing addr.
+  \param[in]   addr  address in the page
+  \return      FLASH_ASYNC_OK or status code
+*/
+extern int32_t FlashAsync_Erase (uint32_t addr);
+
+/**
+  \fn          int32_t FlashAsync_Program (uint32_t addr, const void *data, uint32_t len)
+  \brief       Queue programming of data.
+  \param[in]   addr  16-byte aligned start address
+  \param[in]   data  data, must stay valid until the request has completed
+  \param[in]   len   number of bytes (multiple of 16)
+  \return      FLASH_ASYNC_OK or status code
+*/
+extern int32_t FlashAsync_Program (uint32_t addr, const void *data, uint32_t len);
+
+/**
+  \fn          uint32_t FlashAsync_GetPending (void)
+  \brief       Get the number of queued requests, including the active one.
+  \return      pending requests
+*/
+extern uint32_t FlashAsync_GetPending (void);
+
+/**
+  \fn          void FlashAsync_IRQHandler (void)
+  \brief       Flash interrupt handler (when not provided by the driver).
+*/
+extern void FlashAsync_IRQHandler (void);
+
+#endif /* FLASH_ASYNC_H */
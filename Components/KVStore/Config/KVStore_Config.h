@@ -0,0 +1,45 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store configuration for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+
+// <h>Key-Value Store
+
+//   <o>Sector Start Address <0x08000000-0x081FFFFF>
+//   <i>Address of the first flash page used by the store (page aligned).
+#define KV_SECTOR_ADDR          0x080F0000
+
+//   <o>Sector Size <0x1000=> 4 KB <0x2000=> 8 KB
+//   <i>Multiple of the flash page size (8 KB, 4 KB on STM32WBA2x).
+#define KV_SECTOR_SIZE          0x2000
+
+//   <o>Number of Sectors <3-64>
+//   <i>Consecutive flash pages used by the store.
+//   <i>One sector is always kept erased for compaction, a second one
+//   <i>takes over when the head sector is closed by an interrupted write.
+#define KV_SECTOR_NUM           4
+
+//   <o>Number of Keys <1-4096>
+//   <i>Keys are in the range 0 .. Number of Keys - 1.
+//   <i>The RAM index uses 4 bytes per key.
+#define KV_KEY_NUM              64
+
+//   <o>Maximum Value Size <1-4096>
+#define KV_VALUE_MAX            256
+
+//   <o>Compaction Threshold <2-64>
+//   <i>KV_Compact starts to reclaim the oldest sector when fewer erased
+//   <i>sectors than this remain.
+#define KV_GC_FREE              2
+
+// </h>
+
+//------------- <<< end of configuration section >>> ---------------------------
@@ -0,0 +1,521 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+/* History:
+ *  Version 1.0.0
+ *    Initial release
+ */
+
+/* Note:
+   Sector layout (all items are 16-byte quad-words):
+     +0x00  format header   { KV_MAGIC, wear, ~wear, KV_MAGIC_FMT }
+     +0x10  open header     { seq, ~seq, KV_MAGIC_OPEN, 0 }
+     +0x20  records ...
+
+   The format header is written right after the erase, so the erase count
+   survives a reset. The open header gives the position of the sector in
+   the log. A record is a header quad-word followed by the value padded to
+   quad-words:
+     { key | (len << 16), type, crc32(value), crc32(header words 0..2) }
+
+   The header is programmed first; a record with a valid header and a bad
+   value CRC was interrupted and is skipped. A header that fails its own
+   check was torn by a reset and is skipped as one quad-word; the records
+   written after the reset follow it, so the sector stays usable.  */
+
+#include <string.h>
+
+#include "KVStore.h"
+#include "KVStore_Flash.h"
+#include "KVStore_Config.h"
+
+#define KV_QW               16U         // Quad-word size
+#define KV_DATA_OFS         (2U * KV_QW)
+#define KV_SECT_END(s)      (KV_SECT_ADDR(s) + KV_SECTOR_SIZE)
+#define KV_SECT_ADDR(s)     (KV_SECTOR_ADDR + ((uint32_t)(s) * KV_SECTOR_SIZE))
+#define KV_REC_SIZE(len)    (KV_QW + (((len) + (KV_QW - 1U)) & ~(KV_QW - 1U)))
+
+#define KV_MAGIC            0x3153564BU // "KVS1"
+#define KV_MAGIC_FMT        0x544D5246U // "FRMT"
+#define KV_MAGIC_OPEN       0x4E45504FU // "OPEN"
+
+#define KV_TYPE_VALUE       0x554C4156U // "VALU"
+#define KV_TYPE_DELETE      0x454C4544U // "DELE"
+
+#define KV_SEQ_FREE         0U          // Sector erased and formatted
+
+#if (KV_SECTOR_NUM < 3)
+#error "KV_SECTOR_NUM must be at least 3"
+#endif
+#if (KV_REC_SIZE(KV_VALUE_MAX) > (KV_SECTOR_SIZE - KV_DATA_OFS))
+#error "KV_VALUE_MAX does not fit into one sector"
+#endif
+
+static uint32_t kv_index[KV_KEY_NUM];   // Address of the latest record, 0 = none
+static uint32_t kv_seq  [KV_SECTOR_NUM];// Log sequence of the sector, 0 = free
+static uint32_t kv_wear [KV_SECTOR_NUM];// Erase count of the sector
+static uint32_t kv_head;                // Sector that is appended to
+static uint32_t kv_wr;                  // Next record address in kv_head
+static uint32_t kv_next_seq;            // Sequence for the next opened sector
+static uint32_t kv_gc_sect;             // Sector under compaction
+static uint32_t kv_gc_pos;              // Next record to compact, 0 = idle
+static uint8_t  kv_mounted;
+
+static const uint32_t kv_crc_tab[16] = {
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+  0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+  0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+
+/* CRC-32 (IEEE 802.3), crc = 0 for the first block */
+static uint32_t kv_crc (uint32_t crc, const uint8_t *p, uint32_t len) {
+  crc = ~crc;
+  while (len-- != 0U) {
+    crc ^= *p++;
+    crc  = (crc >> 4) ^ kv_crc_tab[crc & 0x0FU];
+    crc  = (crc >> 4) ^ kv_crc_tab[crc & 0x0FU];
+  }
+  return ~crc;
+}
+
+/* CRC-32 of len bytes of flash at addr */
+static uint32_t kv_crc_flash (uint32_t addr, uint32_t len) {
+  uint8_t  buf[KV_QW];
+  uint32_t crc = 0U;
+  uint32_t n;
+
+  while (len != 0U) {
+    n = (len > KV_QW) ? KV_QW : len;
+    KV_FlashRead(addr, buf, n);
+    crc   = kv_crc(crc, buf, n);
+    addr += n;
+    len  -= n;
+  }
+  return crc;
+}
+
+static int32_t kv_qw_erased (const uint32_t *qw) {
+  return ((qw[0] & qw[1] & qw[2] & qw[3]) == 0xFFFFFFFFU) ? 1 : 0;
+}
+
+/* Decode a record header, returns record size or 0 when invalid */
+static uint32_t kv_rec_check (const uint32_t *qw, uint32_t addr, uint32_t end) {
+  uint32_t key = qw[0] & 0xFFFFU;
+  uint32_t len = qw[0] >> 16;
+  uint32_t size;
+
+  if (kv_crc(0U, (const uint8_t *)qw, 12U) != qw[3]) {
+    return 0U;
+  }
+  if ((key >= KV_KEY_NUM) || (len > KV_VALUE_MAX)) {
+    return 0U;
+  }
+  if ((qw[1] != KV_TYPE_VALUE) && (qw[1] != KV_TYPE_DELETE)) {
+    return 0U;
+  }
+  size = KV_REC_SIZE(len);
+  if ((end - addr) < size) {
+    return 0U;
+  }
+  return size;
+}
+
+/* Size of the record at addr, 0 at the end of the records.
+   A torn header is skipped as one quad-word with *torn = 1. */
+static uint32_t kv_rec_next (const uint32_t *qw, uint32_t addr, uint32_t end, uint32_t *torn) {
+  uint32_t size;
+
+  *torn = 0U;
+  if (kv_qw_erased(qw)) {
+    return 0U;
+  }
+  size = kv_rec_check(qw, addr, end);
+  if (size == 0U) {
+    *torn = 1U;
+    size  = KV_QW;
+  }
+  return size;
+}
+
+/* Erase a sector and write its format header */
+static int32_t kv_format (uint32_t s, uint32_t wear) {
+  uint32_t qw[4];
+
+  kv_seq [s] = KV_SEQ_FREE;
+  kv_wear[s] = wear;
+  if (KV_FlashErase(KV_SECT_ADDR(s)) != 0) {
+    return KV_ERROR;
+  }
+  qw[0] = KV_MAGIC;
+  qw[1] = wear;
+  qw[2] = ~wear;
+  qw[3] = KV_MAGIC_FMT;
+  if (KV_FlashProgram(KV_SECT_ADDR(s), qw) != 0) {
+    return KV_ERROR;
+  }
+  return KV_OK;
+}
+
+static uint32_t kv_free_sectors (void) {
+  uint32_t s, n = 0U;
+
+  for (s = 0U; s < KV_SECTOR_NUM; s++) {
+    if (kv_seq[s] == KV_SEQ_FREE) n++;
+  }
+  return n;
+}
+
+/* Oldest sector in the log */
+static uint32_t kv_oldest (void) {
+  uint32_t s, old = kv_head;
+
+  for (s = 0U; s < KV_SECTOR_NUM; s++) {
+    if ((kv_seq[s] != KV_SEQ_FREE) && (kv_seq[s] < kv_seq[old])) old = s;
+  }
+  return old;
+}
+
+/* Open the least worn free sector as new head */
+static int32_t kv_open (void) {
+  uint32_t s, sel = KV_SECTOR_NUM;
+  uint32_t qw[4];
+
+  for (s = 0U; s < KV_SECTOR_NUM; s++) {
+    if ((kv_seq[s] == KV_SEQ_FREE) && ((sel == KV_SECTOR_NUM) || (kv_wear[s] < kv_wear[sel]))) {
+      sel = s;
+    }
+  }
+  if (sel == KV_SECTOR_NUM) {
+    return KV_ERROR_NO_SPACE;
+  }
+
+  qw[0] = kv_next_seq;
+  qw[1] = ~kv_next_seq;
+  qw[2] = KV_MAGIC_OPEN;
+  qw[3] = 0U;
+  kv_seq[sel] = kv_next_seq++;
+  kv_head = sel;
+  kv_wr   = KV_SECT_ADDR(sel) + KV_DATA_OFS;
+  if (KV_FlashProgram(KV_SECT_ADDR(sel) + KV_QW, qw) != 0) {
+    kv_wr = KV_SECT_END(sel);           // do not append to a broken sector
+    return KV_ERROR;
+  }
+  return KV_OK;
+}
+
+/* Make room for size bytes in the head; compaction may use the last free sector */
+static int32_t kv_reserve (uint32_t size, uint32_t gc) {
+  if ((KV_SECT_END(kv_head) - kv_wr) >= size) {
+    return KV_OK;
+  }
+  if (kv_free_sectors() > (gc ? 0U : 1U)) {
+    return kv_open();
+  }
+  return KV_ERROR_NO_SPACE;
+}
+
+/* Append a record; data == NULL copies the value from flash at src */
+static int32_t kv_append (const uint32_t *hdr, const uint8_t *data, uint32_t src, uint32_t len) {
+  uint32_t qw[4];
+  uint32_t addr = kv_wr;
+  uint32_t n;
+
+  kv_wr += KV_REC_SIZE(len);
+  if (KV_FlashProgram(addr, hdr) != 0) {
+    return KV_ERROR;
+  }
+  while (len != 0U) {
+    n = (len > KV_QW) ? KV_QW : len;
+    memset(qw, 0xFF, KV_QW);
+    if (data != NULL) {
+      memcpy(qw, data, n);
+      data += n;
+    } else {
+      KV_FlashRead(src, qw, n);
+      src += n;
+    }
+    addr += KV_QW;
+    if (KV_FlashProgram(addr, qw) != 0) {
+      return KV_ERROR;
+    }
+    len -= n;
+  }
+  return KV_OK;
+}
+
+/* Replay the records of one sector into the index */
+static void kv_replay (uint32_t s) {
+  uint32_t qw[4];
+  uint32_t addr = KV_SECT_ADDR(s) + KV_DATA_OFS;
+  uint32_t end  = KV_SECT_END(s);
+  uint32_t size, torn;
+
+  while (addr < end) {
+    KV_FlashRead(addr, qw, KV_QW);
+    size = kv_rec_next(qw, addr, end, &torn);
+    if (size == 0U) {
+      break;
+    }
+    if ((torn == 0U) && (kv_crc_flash(addr + KV_QW, qw[0] >> 16) == qw[2])) {
+      kv_index[qw[0] & 0xFFFFU] = (qw[1] == KV_TYPE_VALUE) ? addr : 0U;
+    }
+    addr += size;
+  }
+  if (s == kv_head) {
+    kv_wr = addr;
+  }
+}
+
+/* One compaction step: copy one live record or erase the emptied sector.
+   Returns 1 when a step was done, 0 when there is nothing to reclaim. */
+static int32_t kv_gc_step (void) {
+  uint32_t qw[4];
+  uint32_t end, size, addr, dst, torn;
+  int32_t  status;
+
+  if (kv_gc_pos == 0U) {
+    kv_gc_sect = kv_oldest();
+    if (kv_gc_sect == kv_head) {
+      return 0;                         // nothing to reclaim
+    }
+    kv_gc_pos = KV_SECT_ADDR(kv_gc_sect) + KV_DATA_OFS;
+  }
+
+  end = KV_SECT_END(kv_gc_sect);
+  while (kv_gc_pos < end) {
+    addr = kv_gc_pos;
+    KV_FlashRead(addr, qw, KV_QW);
+    size = kv_rec_next(qw, addr, end, &torn);
+    if (size == 0U) {
+      break;
+    }
+    kv_gc_pos += size;
+    if ((torn == 0U) && (kv_index[qw[0] & 0xFFFFU] == addr)) {  // live value
+      status = kv_reserve(size, 1U);
+      if (status != KV_OK) {
+        kv_gc_pos = addr;
+        return status;
+      }
+      dst    = kv_wr;
+      status = kv_append(qw, NULL, addr + KV_QW, qw[0] >> 16);
+      if (status != KV_OK) {
+        return status;
+      }
+      kv_index[qw[0] & 0xFFFFU] = dst;
+      return 1;
+    }
+  }
+
+  kv_gc_pos = 0U;
+  status = kv_format(kv_gc_sect, kv_wear[kv_gc_sect] + 1U);
+  return (status != KV_OK) ? status : 1;
+}
+
+/* Append a record, compacting in the foreground when the store is full */
+static int32_t kv_put (uint32_t key, uint32_t type, const uint8_t *data, uint32_t len) {
+  uint32_t hdr[4];
+  uint32_t size = KV_REC_SIZE(len);
+  uint32_t limit = 2U * KV_SECTOR_NUM;  // sector reclaims before giving up
+  uint32_t dst;
+  int32_t  status;
+
+  /* no erased sector left: finish reclaiming the oldest sector first, so
+     that the live data of a sector always fits into the sector opened last */
+  while ((kv_free_sectors() == 0U) && ((kv_gc_pos != 0U) || (kv_oldest() != kv_head))) {
+    status = kv_gc_step();
+    if (status < 0) {
+      return status;
+    }
+  }
+
+  while ((KV_SECT_END(kv_head) - kv_wr) < size) {
+    if (kv_free_sectors() > 1U) {
+      status = kv_open();
+    } else if ((kv_gc_pos != 0U) || (kv_oldest() != kv_head)) {
+      if (kv_gc_pos == 0U) {
+        if (limit-- == 0U) {
+          return KV_ERROR_NO_SPACE;
+        }
+      }
+      status = kv_gc_step();
+    } else {
+      status = kv_open();               // single full sector: move on to the spare
+    }
+    if (status < 0) {
+      return status;
+    }
+  }
+
+  hdr[0] = key | (len << 16);
+  hdr[1] = type;
+  hdr[2] = kv_crc(0U, data, len);
+  hdr[3] = kv_crc(0U, (const uint8_t *)hdr, 12U);
+  dst    = kv_wr;
+  status = kv_append(hdr, data, 0U, len);
+  if (status != KV_OK) {
+    return status;                      // previous value stays valid
+  }
+  kv_index[key] = (type == KV_TYPE_VALUE) ? dst : 0U;
+  return KV_OK;
+}
+
+
+/* Mount the store */
+int32_t KV_Init (void) {
+  uint32_t qw[4];
+  uint32_t s, k, max, addr;
+  int32_t  status;
+
+  kv_mounted  = 0U;
+  kv_gc_pos   = 0U;
+  kv_next_seq = 1U;
+  kv_head     = 0U;
+  memset(kv_index, 0, sizeof(kv_index));
+
+  for (s = 0U; s < KV_SECTOR_NUM; s++) {
+    addr = KV_SECT_ADDR(s);
+    KV_FlashRead(addr, qw, KV_QW);
+    if ((qw[0] == KV_MAGIC) && (qw[3] == KV_MAGIC_FMT) && (qw[1] == ~qw[2])) {
+      kv_wear[s] = qw[1];
+      KV_FlashRead(addr + KV_QW, qw, KV_QW);
+      if ((qw[2] == KV_MAGIC_OPEN) && (qw[0] == ~qw[1]) && (qw[0] != KV_SEQ_FREE)) {
+        kv_seq[s] = qw[0];
+        if (qw[0] >= kv_next_seq) {
+          kv_next_seq = qw[0] + 1U;
+          kv_head     = s;
+        }
+        continue;
+      }
+      if (kv_qw_erased(qw)) {
+        kv_seq[s] = KV_SEQ_FREE;
+        continue;
+      }
+      status = kv_format(s, kv_wear[s] + 1U);  // interrupted open
+    } else {
+      status = kv_format(s, 0U);        // blank, interrupted erase or foreign data
+    }
+    if (status != KV_OK) {
+      return status;
+    }
+  }
+
+  if (kv_seq[kv_head] == KV_SEQ_FREE) {
+    status = kv_open();                 // empty store
+    if (status != KV_OK) {
+      return status;
+    }
+  } else {
+    /* replay sectors in log order */
+    for (max = 0U;;) {
+      k = KV_SECTOR_NUM;
+      for (s = 0U; s < KV_SECTOR_NUM; s++) {
+        if ((kv_seq[s] > max) && ((k == KV_SECTOR_NUM) || (kv_seq[s] < kv_seq[k]))) {
+          k = s;
+        }
+      }
+      if (k == KV_SECTOR_NUM) {
+        break;
+      }
+      kv_replay(k);
+      max = kv_seq[k];
+    }
+  }
+
+  kv_mounted = 1U;
+  return KV_OK;
+}
+
+/* Store a value */
+int32_t KV_Write (uint32_t key, const void *data, uint32_t len) {
+  uint32_t hdr[4];
+  uint32_t addr;
+
+  if ((kv_mounted == 0U) || (key >= KV_KEY_NUM) || (data == NULL) ||
+      (len == 0U) || (len > KV_VALUE_MAX)) {
+    return KV_ERROR_PARAMETER;
+  }
+
+  /* unchanged value: nothing to program */
+  addr = kv_index[key];
+  if (addr != 0U) {
+    KV_FlashRead(addr, hdr, KV_QW);
+    if (((hdr[0] >> 16) == len) && (hdr[2] == kv_crc(0U, data, len)) &&
+        (kv_crc_flash(addr + KV_QW, len) == hdr[2])) {
+      return KV_OK;
+    }
+  }
+
+  return kv_put(key, KV_TYPE_VALUE, data, len);
+}
+
+/* Read a value */
+int32_t KV_Read (uint32_t key, void *data, uint32_t size) {
+  uint32_t hdr[4];
+  uint32_t addr, len;
+
+  if ((kv_mounted == 0U) || (key >= KV_KEY_NUM) || (data == NULL)) {
+    return KV_ERROR_PARAMETER;
+  }
+  addr = kv_index[key];
+  if (addr == 0U) {
+    return KV_ERROR_NOT_FOUND;
+  }
+  KV_FlashRead(addr, hdr, KV_QW);
+  len = hdr[0] >> 16;
+  if (len > size) {
+    return KV_ERROR_PARAMETER;
+  }
+  KV_FlashRead(addr + KV_QW, data, len);
+  if (kv_crc(0U, data, len) != hdr[2]) {
+    return KV_ERROR_CORRUPT;
+  }
+  return (int32_t)len;
+}
+
+/* Remove a key */
+int32_t KV_Delete (uint32_t key) {
+  if ((kv_mounted == 0U) || (key >= KV_KEY_NUM)) {
+    return KV_ERROR_PARAMETER;
+  }
+  if (kv_index[key] == 0U) {
+    return KV_ERROR_NOT_FOUND;
+  }
+  return kv_put(key, KV_TYPE_DELETE, NULL, 0U);
+}
+
+/* Background compaction step */
+int32_t KV_Compact (void) {
+  int32_t status;
+
+  if (kv_mounted == 0U) {
+    return KV_ERROR_PARAMETER;
+  }
+  if ((kv_gc_pos == 0U) && (kv_free_sectors() >= KV_GC_FREE)) {
+    return 0;
+  }
+  status = kv_gc_step();
+  if (status <= 0) {
+    return status;
+  }
+  return ((kv_gc_pos != 0U) || (kv_free_sectors() < KV_GC_FREE)) ? 1 : 0;
+}
+
+/* Bytes that can be appended without compaction */
+uint32_t KV_GetFree (void) {
+  uint32_t n = kv_free_sectors();
+  uint32_t free = KV_SECT_END(kv_head) - kv_wr;
+
+  if (n > 1U) {
+    free += (n - 1U) * (KV_SECTOR_SIZE - KV_DATA_OFS);
+  }
+  return free;
+}
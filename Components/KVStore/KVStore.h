@@ -0,0 +1,82 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Records are appended to a log of flash sectors as 16-byte aligned
+   quad-words, so a write costs one quad-word program per 16 bytes instead
+   of a page erase and rewrite. A RAM index holds the address of the latest
+   record of every key. KV_Compact reclaims the oldest sector in small steps
+   and should be called from the idle loop; sectors are reused in log order
+   and the least worn erased sector is opened next.  */
+
+#ifndef KVSTORE_H
+#define KVSTORE_H
+
+#include <stdint.h>
+
+// Status codes
+#define KV_OK                   0       // Operation succeeded
+#define KV_ERROR               -1       // Flash operation failed
+#define KV_ERROR_PARAMETER     -2       // Invalid parameter
+#define KV_ERROR_NOT_FOUND     -3       // Key not present
+#define KV_ERROR_NO_SPACE      -4       // Store is full of live data
+#define KV_ERROR_CORRUPT       -5       // Record check failed
+
+/**
+  \fn          int32_t KV_Init (void)
+  \brief       Mount the store: scan all sectors and build the RAM index.
+  \return      KV_OK or status code
+*/
+extern int32_t KV_Init (void);
+
+/**
+  \fn          int32_t KV_Write (uint32_t key, const void *data, uint32_t len)
+  \brief       Store a value; replaces the previous value of the key.
+  \param[in]   key   key (0 .. KV_KEY_NUM - 1)
+  \param[in]   data  value
+  \param[in]   len   value length in bytes (1 .. KV_VALUE_MAX)
+  \return      KV_OK or status code
+*/
+extern int32_t KV_Write (uint32_t key, const void *data, uint32_t len);
+
+/**
+  \fn          int32_t KV_Read (uint32_t key, void *data, uint32_t size)
+  \brief       Read the value of a key.
+  \param[in]   key   key (0 .. KV_KEY_NUM - 1)
+  \param[out]  data  buffer for the value
+  \param[in]   size  size of the buffer in bytes
+  \return      value length in bytes or status code
+*/
+extern int32_t KV_Read (uint32_t key, void *data, uint32_t size);
+
+/**
+  \fn          int32_t KV_Delete (uint32_t key)
+  \brief       Remove a key.
+  \param[in]   key   key (0 .. KV_KEY_NUM - 1)
+  \return      KV_OK or status code
+*/
+extern int32_t KV_Delete (uint32_t key);
+
+/**
+  \fn          int32_t KV_Compact (void)
+  \brief       Run one step of the background compaction.
+  \return      1 when more work is pending, 0 when idle, or status code
+*/
+extern int32_t KV_Compact (void);
+
+/**
+  \fn          uint32_t KV_GetFree (void)
+  \brief       Get the number of bytes that can be appended without compaction.
+  \return      free bytes
+*/
+extern uint32_t KV_GetFree (void);
+
+#endif /* KVSTORE_H */
@@ -0,0 +1,186 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store flash interface for ST STM32WBAx Flash
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Register definitions, unlock sequence and bank/page computation follow
+   CMSIS/Flash/STM32WBAxx/FlashPrg.c. Secure applications use the secure
+   control and status registers, all others the non-secure ones.
+   The flash page size is 8 KB, 4 KB on STM32WBA2x (as in FlashDev.c);
+   a KV sector of several pages is erased page by page.
+   Code executing from the same flash bank is stalled while an operation
+   is in progress. ICACHE (enabled by CubeMX by default) also caches the
+   data reads of KV_FlashRead, so it is invalidated after every erase and
+   program.  */
+
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "KVStore_Flash.h"
+#include "KVStore_Config.h"
+
+#define M32(adr)          (*((volatile uint32_t *) (adr)))
+
+// Flash Registers (FLASH_TypeDef of the device header)
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+#define FLASH_KEYR        FLASH->SECKEYR
+#define FLASH_SR          FLASH->SECSR
+#define FLASH_CR          FLASH->SECCR1
+#else
+#define FLASH_KEYR        FLASH->NSKEYR
+#define FLASH_SR          FLASH->NSSR
+#define FLASH_CR          FLASH->NSCR1
+#endif
+
+#define FLASHSIZE_BASE    (0x0BFA07A0)
+
+// Flash Keys
+#define KV_FLASH_KEY1     0x45670123U
+#define KV_FLASH_KEY2     0xCDEF89ABU
+
+// Flash Control Register definition
+#define KV_FLASH_PG       (1UL <<  0)
+#define KV_FLASH_PER      (1UL <<  1)
+#define KV_FLASH_PNB_Pos  3U
+#define KV_FLASH_BKER     (1UL << 11)
+#define KV_FLASH_STRT     (1UL << 16)
+#define KV_FLASH_LOCK     (1UL << 31)
+
+// Flash Status Register definition
+#define KV_FLASH_BSY      (1UL << 16)
+#define KV_FLASH_ERR      ((1UL << 1) | (1UL << 3) | (1UL << 4) | (1UL << 5) | \
+                           (1UL << 6) | (1UL << 7))
+
+// Flash Option Register definition
+#define KV_FLASH_DUALBANK (1UL << 21)
+
+#if defined(FLASH_PAGE_SIZE)
+#define KV_PAGE_SIZE      FLASH_PAGE_SIZE       // device header
+#elif defined(STM32WBA23xx) || defined(STM32WBA25xx)
+#define KV_PAGE_SIZE      0x1000U
+#else
+#define KV_PAGE_SIZE      0x2000U
+#endif
+
+#if ((KV_SECTOR_SIZE % KV_PAGE_SIZE) != 0) || ((KV_SECTOR_ADDR % KV_PAGE_SIZE) != 0)
+#error "KV_SECTOR_SIZE and KV_SECTOR_ADDR must be multiples of the flash page size"
+#endif
+
+/* Flash size in bytes */
+static uint32_t FlashSize (void) {
+  return ((M32(FLASHSIZE_BASE) & 0xFFFFU) * 0x400U);
+}
+
+/* Dual-bank flash: not device 0x492, and 2MB or DUALBANK option set */
+static uint32_t FlashDualBank (void) {
+  if ((DBGMCU->IDCODE & 0xFFFU) == 0x492U) {
+    return 0U;
+  }
+  if ((FlashSize() < 0x200000U) && ((FLASH->OPTR & KV_FLASH_DUALBANK) == 0U)) {
+    return 0U;
+  }
+  return 1U;
+}
+
+static void FlashUnlock (void) {
+  if ((FLASH_CR & KV_FLASH_LOCK) != 0U) {
+    FLASH_KEYR = KV_FLASH_KEY1;
+    FLASH_KEYR = KV_FLASH_KEY2;
+  }
+}
+
+static int32_t FlashWait (void) {
+  uint32_t sr;
+
+  while (FLASH_SR & KV_FLASH_BSY);
+  sr = FLASH_SR;
+  if (sr & KV_FLASH_ERR) {
+    FLASH_SR = sr & KV_FLASH_ERR;       // Reset Error Flags
+    return -1;
+  }
+  return 0;
+}
+
+/* Invalidate ICACHE after flash contents changed */
+static void CacheInvalidate (void) {
+
+  if ((ICACHE->CR & ICACHE_CR_EN) != 0U) {
+    ICACHE->CR |= ICACHE_CR_CACHEINV;
+    while ((ICACHE->SR & ICACHE_SR_BUSYF) != 0U);
+  }
+}
+
+/* Erase one flash page at addr */
+static int32_t FlashErasePage (uint32_t addr) {
+  uint32_t ofs, page, bank2;
+  int32_t  status;
+
+  ofs = addr & 0x03FFFFFFU;             // offset in 0x08000000 or 0x0C000000 alias
+
+  bank2 = 0U;
+  if (FlashDualBank() != 0U) {
+    if (ofs >= (FlashSize() / 2U)) {
+      ofs  -= FlashSize() / 2U;
+      bank2 = 1U;
+    }
+  }
+  page = ofs / KV_PAGE_SIZE;
+
+  FlashUnlock();
+  (void)FlashWait();
+  FLASH_CR = KV_FLASH_PER | (page << KV_FLASH_PNB_Pos) | (bank2 ? KV_FLASH_BKER : 0U);
+  FLASH_CR |= KV_FLASH_STRT;
+  status = FlashWait();
+  FLASH_CR = KV_FLASH_LOCK;
+  CacheInvalidate();
+  return status;
+}
+
+/* Erase the sector at addr (all its pages) */
+int32_t KV_FlashErase (uint32_t addr) {
+  uint32_t n;
+
+  for (n = 0U; n < (KV_SECTOR_SIZE / KV_PAGE_SIZE); n++) {
+    if (FlashErasePage(addr + (n * KV_PAGE_SIZE)) != 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/* Program one quad-word at addr */
+int32_t KV_FlashProgram (uint32_t addr, const uint32_t *qw) {
+  uint32_t primask;
+  int32_t  status;
+
+  FlashUnlock();
+  (void)FlashWait();
+  FLASH_CR = KV_FLASH_PG;
+
+  primask = __get_PRIMASK();            // quad-word must not be split by an ISR
+  __disable_irq();
+  M32(addr     ) = qw[0];
+  M32(addr +  4) = qw[1];
+  M32(addr +  8) = qw[2];
+  M32(addr + 12) = qw[3];
+  __set_PRIMASK(primask);
+
+  status = FlashWait();
+  FLASH_CR = KV_FLASH_LOCK;
+  CacheInvalidate();
+  return status;
+}
+
+/* Read from flash */
+void KV_FlashRead (uint32_t addr, void *buf, uint32_t len) {
+  memcpy(buf, (const void *)addr, len);
+}
@@ -0,0 +1,42 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store flash interface
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Flash primitives used by KVStore.c. KVStore_Flash.c implements them for
+   the STM32WBA flash controller; a different implementation (for example
+   on a RAM array) can be linked instead.  */
+
+#ifndef KVSTORE_FLASH_H
+#define KVSTORE_FLASH_H
+
+#include <stdint.h>
+
+/**
+  \fn          int32_t KV_FlashErase (uint32_t addr)
+  \brief       Erase the flash sector starting at addr.
+  \return      0 - OK,  -1 - Failed
+*/
+extern int32_t KV_FlashErase (uint32_t addr);
+
+/**
+  \fn          int32_t KV_FlashProgram (uint32_t addr, const uint32_t *qw)
+  \brief       Program one quad-word (16 bytes) at the 16-byte aligned addr.
+  \return      0 - OK,  -1 - Failed
+*/
+extern int32_t KV_FlashProgram (uint32_t addr, const uint32_t *qw);
+
+/**
+  \fn          void KV_FlashRead (uint32_t addr, void *buf, uint32_t len)
+  \brief       Read len bytes of flash at addr.
+*/
+extern void KV_FlashRead (uint32_t addr, void *buf, uint32_t len);
+
+#endif /* KVSTORE_FLASH_H */
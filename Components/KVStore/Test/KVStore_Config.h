@@ -0,0 +1,20 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store configuration for the host test
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Small sectors so that the test wraps the log many times.  */
+
+#define KV_SECTOR_ADDR          0x080F0000
+#define KV_SECTOR_SIZE          0x0400
+#define KV_SECTOR_NUM           4
+#define KV_KEY_NUM              16
+#define KV_VALUE_MAX            64
+#define KV_GC_FREE              2
@@ -0,0 +1,94 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store flash interface on a RAM array (host test)
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Emulates the flash semantics KVStore.c relies on: erase sets all bytes
+   to 0xFF, a quad-word is programmed once after an erase (programming a
+   non-erased quad-word fails like PROGERR on the device).
+   kv_ram_fail counts down the erase and program operations; the operation
+   that reaches 0 is torn as by a power loss (a prefix of the words, the
+   last one with random bits cleared, or a part of the sector erased) and
+   control returns to kv_ram_reset with longjmp.  */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "KVStore_Flash.h"
+#include "KVStore_Config.h"
+#include "KVStore_Flash_RAM.h"
+
+uint8_t  kv_ram[KV_SECTOR_SIZE * KV_SECTOR_NUM];
+uint32_t kv_ram_fail;                   // operations until power loss, 0 = off
+uint32_t kv_ram_ops;                    // erase and program operations done
+jmp_buf  kv_ram_reset;
+
+static uint8_t *kv_ram_ptr (uint32_t addr, uint32_t len) {
+  if ((addr < KV_SECTOR_ADDR) || ((addr - KV_SECTOR_ADDR) + len > sizeof(kv_ram))) {
+    abort();                            // store outside its sectors
+  }
+  return &kv_ram[addr - KV_SECTOR_ADDR];
+}
+
+/* Count an operation, returns 1 when the power fails now */
+static int32_t kv_ram_power_loss (void) {
+  kv_ram_ops++;
+  if (kv_ram_fail != 0U) {
+    if (--kv_ram_fail == 0U) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int32_t KV_FlashErase (uint32_t addr) {
+  uint8_t *p;
+
+  if ((addr - KV_SECTOR_ADDR) % KV_SECTOR_SIZE != 0U) {
+    return -1;
+  }
+  p = kv_ram_ptr(addr, KV_SECTOR_SIZE);
+  if (kv_ram_power_loss()) {
+    memset(p, 0xFF, (uint32_t)rand() % KV_SECTOR_SIZE);
+    longjmp(kv_ram_reset, 1);
+  }
+  memset(p, 0xFF, KV_SECTOR_SIZE);
+  return 0;
+}
+
+int32_t KV_FlashProgram (uint32_t addr, const uint32_t *qw) {
+  uint32_t w[4];
+  uint32_t i, n;
+  uint8_t *p;
+
+  if ((addr & 15U) != 0U) {
+    return -1;
+  }
+  p = kv_ram_ptr(addr, 16U);
+  memcpy(w, p, 16U);
+  if ((w[0] & w[1] & w[2] & w[3]) != 0xFFFFFFFFU) {
+    return -1;                          // quad-word not erased
+  }
+  if (kv_ram_power_loss()) {
+    n = (uint32_t)rand() % 4U;
+    for (i = 0U; i < n; i++) {
+      w[i] = qw[i];
+    }
+    w[n] = qw[n] | ((uint32_t)rand() << 1) | 1U;
+    memcpy(p, w, 16U);
+    longjmp(kv_ram_reset, 1);
+  }
+  memcpy(p, qw, 16U);
+  return 0;
+}
+
+void KV_FlashRead (uint32_t addr, void *buf, uint32_t len) {
+  memcpy(buf, kv_ram_ptr(addr, len), len);
+}
@@ -0,0 +1,25 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store flash interface on a RAM array (host test)
+ * --------------------------------------------------------------------------- */
+
+#ifndef KVSTORE_FLASH_RAM_H
+#define KVSTORE_FLASH_RAM_H
+
+#include <setjmp.h>
+#include <stdint.h>
+
+#include "KVStore_Config.h"
+
+extern uint8_t  kv_ram[KV_SECTOR_SIZE * KV_SECTOR_NUM];
+extern uint32_t kv_ram_fail;            // operations until power loss, 0 = off
+extern uint32_t kv_ram_ops;             // erase and program operations done
+extern jmp_buf  kv_ram_reset;           // target of the power loss
+
+#endif /* KVSTORE_FLASH_RAM_H */
@@ -0,0 +1,384 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Key-Value Store host test
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Runs KVStore.c on the RAM flash of KVStore_Flash_RAM.c with the small
+   sectors of Test/KVStore_Config.h. Build and run on the host:
+
+     gcc -std=c99 -Wall -Wextra -I. -I.. -o kvtest KVStore_Test.c KVStore_Flash_RAM.c ../KVStore.c
+     ./kvtest
+
+   Tests:
+     basic       write, read, delete and remount
+     power loss  a workload interrupted at every erase and program (torn
+                 quad-words, partial erase), also during the recovery;
+                 after the remount every key holds its last value, the key
+                 being written its old or its new value
+     compaction  churn with background compaction, values survive remounts
+     wear        the least worn free sector is opened next, the erase counts
+                 stay balanced  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "KVStore.h"
+#include "KVStore_Flash.h"
+#include "KVStore_Config.h"
+#include "KVStore_Flash_RAM.h"
+
+#define SECT_ADDR(s)    (KV_SECTOR_ADDR + ((uint32_t)(s) * KV_SECTOR_SIZE))
+#define KV_MAGIC        0x3153564BU
+#define KV_MAGIC_FMT    0x544D5246U
+#define KV_MAGIC_OPEN   0x4E45504FU
+
+#define OP_NONE         0xFFFFFFFFU
+
+typedef struct {
+  uint32_t len;                         // 0 = key not present
+  uint8_t  data[KV_VALUE_MAX];
+} value_t;
+
+static value_t  model[KV_KEY_NUM];      // expected content of the store
+static uint32_t fails;
+
+#define CHECK(cond)  do { if (!(cond)) { \
+  printf("  %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+  fails++; return; } } while (0)
+
+static uint32_t hash (uint32_t x) {
+  x ^= x >> 16;  x *= 0x7FEB352DU;
+  x ^= x >> 15;  x *= 0x846CA68BU;
+  x ^= x >> 16;
+  return x;
+}
+
+/* Operation i of the workload: its key and new value, OP_NONE for a compaction step */
+static uint32_t op_decode (uint32_t i, value_t *v) {
+  uint32_t r = hash(i);
+  uint32_t n;
+
+  switch (r % 10U) {
+    case 0U:                            // delete
+      v->len = 0U;
+      break;
+    case 1U:                            // compaction step
+      return OP_NONE;
+    default:
+      v->len = 1U + (hash(r) % KV_VALUE_MAX);
+      for (n = 0U; n < v->len; n++) {
+        v->data[n] = (uint8_t)hash(r + n);
+      }
+      break;
+  }
+  return (r >> 8) % KV_KEY_NUM;
+}
+
+/* Execute operation i and update the model */
+static int32_t op_run (uint32_t i) {
+  value_t  v;
+  uint32_t key = op_decode(i, &v);
+  int32_t  status;
+
+  if (key == OP_NONE) {
+    status = KV_Compact();
+    return (status < 0) ? status : KV_OK;
+  }
+  if (v.len == 0U) {
+    status = KV_Delete(key);
+    if (status == KV_ERROR_NOT_FOUND) {
+      status = (model[key].len == 0U) ? KV_OK : KV_ERROR_CORRUPT;
+    }
+  } else {
+    status = KV_Write(key, v.data, v.len);
+  }
+  if (status == KV_OK) {
+    model[key] = v;
+  }
+  return status;
+}
+
+static int32_t key_equal (uint32_t key, const value_t *v) {
+  uint8_t buf[KV_VALUE_MAX];
+  int32_t len = KV_Read(key, buf, sizeof(buf));
+
+  if (v->len == 0U) {
+    return (len == KV_ERROR_NOT_FOUND);
+  }
+  return ((len == (int32_t)v->len) && (memcmp(buf, v->data, v->len) == 0));
+}
+
+/* Check the store against the model; the key of operation pend may hold either value */
+static int32_t verify (uint32_t pend) {
+  value_t  v;
+  uint32_t key = OP_NONE;
+  uint32_t k;
+
+  if (pend != OP_NONE) {
+    key = op_decode(pend, &v);
+  }
+  for (k = 0U; k < KV_KEY_NUM; k++) {
+    if (key_equal(k, &model[k])) {
+      continue;
+    }
+    if ((k == key) && key_equal(k, &v)) {
+      model[k] = v;                     // interrupted write completed
+      continue;
+    }
+    printf("  key %u differs (pending operation %d)\n", k, (int)pend);
+    return 0;
+  }
+  return 1;
+}
+
+/* Run operations first .. last-1 with a power loss at flash operation fail (0 = none).
+   Returns last, or the operation that was interrupted. */
+static uint32_t run (uint32_t first, uint32_t last, uint32_t fail) {
+  static uint32_t i;                    // static: valid after longjmp
+
+  kv_ram_fail = fail;
+  if (setjmp(kv_ram_reset) != 0) {
+    kv_ram_fail = 0U;
+    return i;
+  }
+  for (i = first; i < last; i++) {
+    if (op_run(i) != KV_OK) {
+      printf("  operation %u failed\n", i);
+      fails++;
+      break;
+    }
+  }
+  kv_ram_fail = 0U;
+  return last;
+}
+
+/* Mount with a power loss at flash operation fail (0 = none); 1 when mounted */
+static int32_t mount (uint32_t fail) {
+  kv_ram_fail = fail;
+  if (setjmp(kv_ram_reset) != 0) {
+    kv_ram_fail = 0U;
+    return 0;
+  }
+  if (KV_Init() != KV_OK) {
+    kv_ram_fail = 0U;
+    return 0;
+  }
+  kv_ram_fail = 0U;
+  return 1;
+}
+
+static void blank (void) {
+  memset(kv_ram, 0xFF, sizeof(kv_ram));
+  memset(model, 0, sizeof(model));
+}
+
+static void read_qw (uint32_t addr, uint32_t *qw) {
+  KV_FlashRead(addr, qw, 16U);
+}
+
+/* Erase count of sector s from its format header */
+static uint32_t sect_wear (uint32_t s) {
+  uint32_t qw[4];
+
+  read_qw(SECT_ADDR(s), qw);
+  return ((qw[0] == KV_MAGIC) && (qw[3] == KV_MAGIC_FMT)) ? qw[1] : 0xFFFFFFFFU;
+}
+
+/* Log sequence of sector s from its open header, 0 when free */
+static uint32_t sect_seq (uint32_t s) {
+  uint32_t qw[4];
+
+  read_qw(SECT_ADDR(s) + 16U, qw);
+  return (qw[2] == KV_MAGIC_OPEN) ? qw[0] : 0U;
+}
+
+/* Sector with the highest sequence (the head) */
+static uint32_t sect_head (void) {
+  uint32_t s, head = 0U;
+
+  for (s = 1U; s < KV_SECTOR_NUM; s++) {
+    if (sect_seq(s) > sect_seq(head)) head = s;
+  }
+  return head;
+}
+
+
+static void test_basic (void) {
+  uint8_t  buf[KV_VALUE_MAX];
+  uint32_t k;
+
+  blank();
+  CHECK(KV_Init() == KV_OK);
+  CHECK(KV_Read(0U, buf, sizeof(buf)) == KV_ERROR_NOT_FOUND);
+  CHECK(KV_Write(KV_KEY_NUM, "x", 1U) == KV_ERROR_PARAMETER);
+  CHECK(KV_Write(0U, "x", 0U) == KV_ERROR_PARAMETER);
+  CHECK(KV_Write(0U, buf, KV_VALUE_MAX + 1U) == KV_ERROR_PARAMETER);
+
+  for (k = 0U; k < KV_KEY_NUM; k++) {
+    model[k].len = 1U + k;
+    memset(model[k].data, (int)k, model[k].len);
+    CHECK(KV_Write(k, model[k].data, model[k].len) == KV_OK);
+  }
+  CHECK(KV_Delete(3U) == KV_OK);
+  model[3].len = 0U;
+  CHECK(KV_Delete(3U) == KV_ERROR_NOT_FOUND);
+  CHECK(KV_Read(1U, buf, 1U) == KV_ERROR_PARAMETER);   // buffer too small
+  CHECK(verify(OP_NONE));
+
+  CHECK(KV_Init() == KV_OK);
+  CHECK(verify(OP_NONE));
+}
+
+/* Power loss at every flash operation of count operations after warm */
+static void power_loss (uint32_t warm, uint32_t count) {
+  static uint8_t  ram[sizeof(kv_ram)];
+  static value_t  saved[KV_KEY_NUM];
+  uint32_t total, fail, i, n, again;
+
+  blank();
+  CHECK(mount(0U));
+  CHECK(run(0U, warm, 0U) == warm);     // wrap the log
+  memcpy(ram, kv_ram, sizeof(ram));
+  memcpy(saved, model, sizeof(saved));
+
+  kv_ram_ops = 0U;
+  CHECK(run(warm, warm + count, 0U) == warm + count);
+  total = kv_ram_ops;
+
+  for (fail = 1U; fail <= total; fail++) {
+    memcpy(kv_ram, ram, sizeof(ram));
+    memcpy(model, saved, sizeof(model));
+    srand(fail);
+    CHECK(mount(0U));
+    i = run(warm, warm + count, fail);
+    CHECK(i < warm + count);
+
+    /* second power loss during the recovery for every other case */
+    again = (fail & 1U) ? (1U + (fail % 3U)) : 0U;
+    if (!mount(again)) {
+      CHECK(mount(0U));
+    }
+    if (!verify(i)) {
+      printf("  power loss at flash operation %u of %u after %u operations\n", fail, total, warm);
+      fails++;
+      return;
+    }
+
+    /* the store stays usable */
+    n = run(i + 1U, i + 1U + count, 0U);
+    CHECK(n == i + 1U + count);
+    CHECK(mount(0U));
+    CHECK(verify(OP_NONE));
+  }
+  printf("  %u power loss points after %u operations\n", total, warm);
+}
+
+static void test_power_loss (void) {
+  power_loss( 300U, 60U);
+  power_loss(1000U, 60U);
+  power_loss(2500U, 60U);
+}
+
+static void test_compaction (void) {
+  uint32_t i, free, steps;
+
+  blank();
+  CHECK(mount(0U));
+  for (i = 0U; i < 20000U; i += 500U) {
+    CHECK(run(i, i + 500U, 0U) == i + 500U);
+    CHECK(verify(OP_NONE));
+
+    /* background compaction until idle */
+    free = KV_GetFree();
+    for (steps = 0U; KV_Compact() == 1; steps++) {
+      CHECK(steps < 1000U);
+    }
+    CHECK(KV_GetFree() >= free);
+    CHECK(KV_GetFree() >= (KV_GC_FREE - 1U) * (KV_SECTOR_SIZE - 32U));
+
+    CHECK(mount(0U));
+    CHECK(verify(OP_NONE));
+  }
+}
+
+static void test_wear (void) {
+  static const uint32_t wear[KV_SECTOR_NUM] = { 5U, 0U, 9U, 3U };
+  uint32_t order[KV_SECTOR_NUM];
+  uint32_t qw[4];
+  uint32_t s, n, lo, hi, head;
+  uint8_t  buf[KV_VALUE_MAX];
+
+  /* formatted free sectors with different erase counts */
+  blank();
+  for (s = 0U; s < KV_SECTOR_NUM; s++) {
+    qw[0] = KV_MAGIC;
+    qw[1] = wear[s];
+    qw[2] = ~wear[s];
+    qw[3] = KV_MAGIC_FMT;
+    CHECK(KV_FlashProgram(SECT_ADDR(s), qw) == 0);
+  }
+  CHECK(mount(0U));
+
+  /* sectors are opened by increasing erase count: 1, 3, 0 */
+  memset(buf, 0x5A, sizeof(buf));
+  n = 0U;
+  order[n++] = sect_head();
+  for (s = 0U; (n < 3U) && (s < 1000U); s++) {
+    buf[0] = (uint8_t)s;
+    CHECK(KV_Write(s % KV_KEY_NUM, buf, KV_VALUE_MAX) == KV_OK);
+    head = sect_head();
+    if (head != order[n - 1U]) {
+      order[n++] = head;
+    }
+  }
+  CHECK((n == 3U) && (order[0] == 1U) && (order[1] == 3U) && (order[2] == 0U));
+  CHECK(sect_seq(2U) == 0U);            // most worn sector still unused
+
+  /* churn: the erase counts catch up with sector 2 and stay balanced */
+  memset(model, 0, sizeof(model));
+  for (s = 0U; s < KV_KEY_NUM; s++) {
+    CHECK(KV_Delete(s) == KV_OK);
+  }
+  CHECK(run(0U, 30000U, 0U) == 30000U);
+  lo = hi = sect_wear(0U);
+  for (s = 1U; s < KV_SECTOR_NUM; s++) {
+    if (sect_wear(s) < lo) lo = sect_wear(s);
+    if (sect_wear(s) > hi) hi = sect_wear(s);
+  }
+  printf("  erase counts %u .. %u\n", lo, hi);
+  CHECK(lo > wear[2]);
+  CHECK((hi - lo) <= 1U);
+  CHECK(mount(0U));
+  CHECK(verify(OP_NONE));
+}
+
+
+int main (void) {
+  static const struct {
+    const char *name;
+    void (*fn)(void);
+  } test[] = {
+    { "basic",      test_basic      },
+    { "power loss", test_power_loss },
+    { "compaction", test_compaction },
+    { "wear",       test_wear       },
+  };
+  uint32_t n, f;
+
+  for (n = 0U; n < sizeof(test) / sizeof(test[0]); n++) {
+    printf("%s\n", test[n].name);
+    f = fails;
+    test[n].fn();
+    printf("  %s\n", (fails == f) ? "PASS" : "FAIL");
+  }
+  printf("%s\n", (fails == 0U) ? "All tests passed" : "Tests failed");
+  return (fails == 0U) ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Secure gateway call benchmark for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Call NSC_Bench_Run from the non-secure main.c (USER CODE BEGIN 2).
+   Round-trip cycles are measured with DWT CYCCNT around the call and
+   averaged over NSC_BENCH_REPEAT calls; "local" is a non-secure call of
+   the same shape for reference.
+   CYCCNT only counts in the secure state while secure non-invasive debug
+   is allowed (for example RDP level 0), otherwise the secure part of the
+   round-trip is missing from the result.  */
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "NSC_Bench.h"
+
+#ifndef NSC_BENCH_REPEAT
+#define NSC_BENCH_REPEAT        64U
+#endif
+
+#define NSC_BENCH_RESULT_MAX    32U
+
+#if defined(__ICCARM__)
+#define NSC_NOINLINE      _Pragma("inline=never")
+#else
+#define NSC_NOINLINE      __attribute__((noinline))
+#endif
+
+NSC_Bench_Result_t NSC_Bench_Result[NSC_BENCH_RESULT_MAX];
+
+static uint32_t          nsc_num;
+static volatile uint32_t nsc_sink;
+static uint32_t          nsc_in [NSC_BENCH_BUF_SIZE / 4U];
+static uint32_t          nsc_out[NSC_BENCH_BUF_SIZE / 4U];
+static uint32_t          nsc_items[NSC_BENCH_ITEMS];
+
+static const uint32_t nsc_size[] = { 16U, 64U, 256U, NSC_BENCH_BUF_SIZE };
+
+// Average cycles of NSC_BENCH_REPEAT evaluations of expr
+#define NSC_MEASURE(name, size, expr)                           \
+  do {                                                          \
+    uint32_t start_, n_;                                        \
+    start_ = DWT->CYCCNT;                                       \
+    for (n_ = 0U; n_ < NSC_BENCH_REPEAT; n_++) {                \
+      nsc_sink += (expr);                                       \
+    }                                                           \
+    AddResult(name, size, (DWT->CYCCNT - start_) / NSC_BENCH_REPEAT); \
+  } while (0)
+
+NSC_NOINLINE static uint32_t LocalArgs4 (uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+  return (a ^ b ^ c ^ d);
+}
+
+static void AddResult (const char *name, uint32_t size, uint32_t cycles) {
+  if (nsc_num < NSC_BENCH_RESULT_MAX) {
+    NSC_Bench_Result[nsc_num].name   = name;
+    NSC_Bench_Result[nsc_num].size   = size;
+    NSC_Bench_Result[nsc_num].cycles = cycles;
+    nsc_num++;
+  }
+}
+
+/* Call NSC_Bench_Item for every item */
+static uint32_t PerItem (void) {
+  uint32_t sum = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < NSC_BENCH_ITEMS; i++) {
+    sum += NSC_Bench_Item(nsc_items[i]);
+  }
+  return sum;
+}
+
+uint32_t NSC_Bench_Run (void) {
+  uint32_t primask, i, size;
+
+  DCB->DEMCR  |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL   |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (i = 0U; i < (NSC_BENCH_BUF_SIZE / 4U); i++) {
+    nsc_in[i] = i;
+  }
+  for (i = 0U; i < NSC_BENCH_ITEMS; i++) {
+    nsc_items[i] = i;
+  }
+  nsc_num = 0U;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  // Call overhead versus register arguments
+  NSC_MEASURE("local",  16U, LocalArgs4(1U, 2U, 3U, 4U));
+  NSC_MEASURE("args0",   0U, NSC_Bench_Args0());
+  NSC_MEASURE("args1",   4U, NSC_Bench_Args1(1U));
+  NSC_MEASURE("args2",   8U, NSC_Bench_Args2(1U, 2U));
+  NSC_MEASURE("args4",  16U, NSC_Bench_Args4(1U, 2U, 3U, 4U));
+
+  // NSC_BENCH_ITEMS items: one call per item versus one batched call
+  NSC_MEASURE("item",  NSC_BENCH_ITEMS * 4U, PerItem());
+  NSC_MEASURE("batch", NSC_BENCH_ITEMS * 4U, NSC_Bench_Batch(nsc_items, NSC_BENCH_ITEMS));
+
+  // Buffer exchange: copy-in/copy-out versus shared buffer
+  for (i = 0U; i < (sizeof(nsc_size) / sizeof(nsc_size[0])); i++) {
+    size = nsc_size[i];
+    NSC_MEASURE("copy",   size, NSC_Bench_Copy(nsc_in, nsc_out, size));
+    NSC_MEASURE("shared", size, NSC_Bench_Shared(nsc_out, size));
+  }
+
+  __set_PRIMASK(primask);
+
+#ifdef RTE_CMSIS_Compiler_STDOUT
+  printf("test,size,cycles\n");
+  for (i = 0U; i < nsc_num; i++) {
+    printf("%s,%u,%u\n", NSC_Bench_Result[i].name,
+           (unsigned int)NSC_Bench_Result[i].size, (unsigned int)NSC_Bench_Result[i].cycles);
+  }
+#endif
+
+  return nsc_num;
+}
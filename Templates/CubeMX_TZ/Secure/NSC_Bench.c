@@ -0,0 +1,107 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Secure gateway call benchmark for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Non-secure callable functions with a minimal body, so the measured
+   cycles are dominated by the SG veneer, the register clearing on return
+   and the argument handling:
+     NSC_Bench_ArgsN   N register arguments
+     NSC_Bench_Item    one item per call
+     NSC_Bench_Batch   array of items per call
+     NSC_Bench_Copy    copy-in to secure RAM, process, copy-out
+     NSC_Bench_Shared  process the non-secure buffer in place (zero-copy)
+   Sizes are limited to NSC_BENCH_BUF_SIZE bytes, so the range passed to
+   cmse_check_address_range cannot wrap, and buffers are checked with it
+   before use. A shared buffer can still be modified by the non-secure side
+   while it is processed, which the copy variant avoids.  */
+
+#include <arm_cmse.h>
+#include <string.h>
+
+#include "NSC_Bench.h"
+
+#if defined(__ICCARM__)
+#define NSC_ENTRY         __cmse_nonsecure_entry
+#else
+#define NSC_ENTRY         __attribute__((cmse_nonsecure_entry))
+#endif
+
+static uint32_t nsc_buf[NSC_BENCH_BUF_SIZE / 4U];
+static uint32_t nsc_acc;
+
+/* Secure side work on a buffer */
+static uint32_t Process (uint32_t *buf, uint32_t num) {
+  uint32_t sum = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < num; i++) {
+    buf[i] += 1U;
+    sum    += buf[i];
+  }
+  return sum;
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Args0 (void) {
+  return 0U;
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Args1 (uint32_t a) {
+  return a;
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Args2 (uint32_t a, uint32_t b) {
+  return (a ^ b);
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Args4 (uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+  return (a ^ b ^ c ^ d);
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Item (uint32_t item) {
+  nsc_acc += item;
+  return nsc_acc;
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Batch (const uint32_t *items, uint32_t num) {
+  uint32_t i;
+
+  if ((num > (NSC_BENCH_BUF_SIZE / 4U)) ||
+      (cmse_check_address_range((void *)items, num * 4U, CMSE_NONSECURE | CMSE_MPU_READ) == NULL)) {
+    return 0U;
+  }
+  for (i = 0U; i < num; i++) {
+    nsc_acc += items[i];
+  }
+  return nsc_acc;
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Copy (const uint32_t *in, uint32_t *out, uint32_t len) {
+  uint32_t sum;
+
+  if ((len > NSC_BENCH_BUF_SIZE) ||
+      (cmse_check_address_range((void *)in, len, CMSE_NONSECURE | CMSE_MPU_READ) == NULL) ||
+      (cmse_check_address_range(out, len, CMSE_NONSECURE | CMSE_MPU_READWRITE) == NULL)) {
+    return 0U;
+  }
+  memcpy(nsc_buf, in, len);
+  sum = Process(nsc_buf, len / 4U);
+  memcpy(out, nsc_buf, len);
+  return sum;
+}
+
+NSC_ENTRY uint32_t NSC_Bench_Shared (uint32_t *buf, uint32_t len) {
+
+  if ((len > NSC_BENCH_BUF_SIZE) ||
+      (cmse_check_address_range(buf, len, CMSE_NONSECURE | CMSE_MPU_READWRITE) == NULL)) {
+    return 0U;
+  }
+  return Process(buf, len / 4U);
+}
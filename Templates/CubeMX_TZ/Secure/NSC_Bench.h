@@ -0,0 +1,55 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Secure gateway call benchmark for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Non-secure callable functions of the Secure project (NSC_Bench.c) and
+   the benchmark of the NonSecure project (NSC_Bench_Run.c).  */
+
+#ifndef NSC_BENCH_H
+#define NSC_BENCH_H
+
+#include <stdint.h>
+
+// Largest buffer passed to the secure side in bytes
+#define NSC_BENCH_BUF_SIZE      1024U
+
+// Number of items of the batched versus per-item test
+#define NSC_BENCH_ITEMS         32U
+
+// Secure functions called from the non-secure state
+extern uint32_t NSC_Bench_Args0  (void);
+extern uint32_t NSC_Bench_Args1  (uint32_t a);
+extern uint32_t NSC_Bench_Args2  (uint32_t a, uint32_t b);
+extern uint32_t NSC_Bench_Args4  (uint32_t a, uint32_t b, uint32_t c, uint32_t d);
+extern uint32_t NSC_Bench_Item   (uint32_t item);
+extern uint32_t NSC_Bench_Batch  (const uint32_t *items, uint32_t num);
+extern uint32_t NSC_Bench_Copy   (const uint32_t *in, uint32_t *out, uint32_t len);
+extern uint32_t NSC_Bench_Shared (uint32_t *buf, uint32_t len);
+
+// Benchmark result
+typedef struct {
+  const char *name;                     // Test name
+  uint32_t    size;                     // Argument size in bytes
+  uint32_t    cycles;                   // Cycles per round-trip
+} NSC_Bench_Result_t;
+
+/**
+  \fn          uint32_t NSC_Bench_Run (void)
+  \brief       Run the benchmark from the non-secure state.
+               Results are stored in NSC_Bench_Result and printed when
+               CMSIS-Compiler STDOUT is used.
+  \return      number of results
+*/
+extern uint32_t NSC_Bench_Run (void);
+
+extern NSC_Bench_Result_t NSC_Bench_Result[];
+
+#endif /* NSC_BENCH_H */
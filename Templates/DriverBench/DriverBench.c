@@ -0,0 +1,392 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      CMSIS-Driver SPI/USART benchmark for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Every bus clock of the list is set with the driver Control function; the
+   clock reported by the driver is printed and duplicates are skipped. For
+   each transfer size DRIVERBENCH_BYTES are transferred and checked:
+     SPI     Transfer of size bytes (MOSI looped back to MISO)
+     USART   Receive and Send of size bytes (TX looped back to RX),
+             Send only in blocking mode, as a blocking Receive would wait
+             for data that is never sent
+   Latency is DWT CYCCNT from the driver call to the last completion event
+   (to the return of the call in blocking mode). CPU idle is the share of
+   the transfer time the CPU spends in the wait loop, calibrated with
+   interrupts disabled. The mode is detected at runtime: blocking when the
+   driver is no longer busy when the call returns, DMA when the CubeMX HAL
+   handle has a DMA channel linked, interrupt otherwise.  */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "Driver_SPI.h"
+#include "Driver_USART.h"
+
+#include "DriverBench.h"
+
+#if defined(DRIVERBENCH_SPI_HANDLE) || defined(DRIVERBENCH_USART_HANDLE)
+#include "main.h"
+#endif
+
+#define DB_CONCAT_(a, b)  a##b
+#define DB_CONCAT(a, b)   DB_CONCAT_(a, b)
+
+#define DB_SIZE_MAX       4096U
+#define DB_TRANSFER_MIN   4U
+
+typedef struct DB_Bus_s DB_Bus_t;
+
+struct DB_Bus_s {
+  const char      *name;
+  const uint32_t  *clock;                       // Bus clocks, 0 terminated
+  uint32_t         bits;                        // Bus bit times per byte
+  uint32_t         done;                        // Events of a completed transfer
+  uint32_t         error;                       // Error events
+  uint32_t         verify;                      // Compare received with sent data
+  uint32_t       (*config) (uint32_t clock);    // Set clock, return actual clock or 0
+  uint32_t       (*probe)  (DB_Bus_t *bus);     // Return 1 for a blocking driver
+  int32_t        (*start)  (const uint8_t *tx, uint8_t *rx, uint32_t num);
+  uint32_t       (*busy)   (void);
+  void           (*abort)  (void);
+  uint32_t       (*dma)    (void);              // Return 1 when DMA is configured
+};
+
+typedef struct {
+  uint32_t transfers;
+  uint32_t errors;
+  uint32_t lat_min;
+  uint32_t lat_max;
+  uint64_t cycles;
+  uint64_t idle;
+} DB_Result_t;
+
+static const uint32_t db_size[] = { 1U, 16U, 64U, 256U, 1024U, DB_SIZE_MAX };
+
+static uint8_t           db_tx[DB_SIZE_MAX];
+static uint8_t           db_rx[DB_SIZE_MAX];
+static volatile uint32_t db_event;
+static volatile uint32_t db_end;
+static uint32_t          db_timeout;
+static uint32_t          db_loop_x16;           // Cycles per wait loop * 16
+
+/* Driver callback of both buses */
+static void DB_Event (uint32_t event) {
+  db_end    = DWT->CYCCNT;
+  db_event |= event;
+}
+
+/* Wait for the done events, return the number of loop iterations */
+static uint32_t IdleWait (uint32_t done, uint32_t start, uint32_t timeout) {
+  uint32_t loops = 0U;
+
+  while ((db_event & done) != done) {
+    loops++;
+    if ((DWT->CYCCNT - start) > timeout) {
+      db_timeout = 1U;
+      break;
+    }
+  }
+  return loops;
+}
+
+/* Cycles of one wait loop iteration, scaled by 16 */
+static void IdleCalibrate (void) {
+  uint32_t primask, start, loops;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  db_event = 0U;
+  start    = DWT->CYCCNT;
+  loops    = IdleWait(1UL << 31, start, 100000U);
+  db_loop_x16 = ((DWT->CYCCNT - start) * 16U) / loops;
+  db_timeout  = 0U;
+  __set_PRIMASK(primask);
+}
+
+/* Cycles to tenths of microseconds */
+static uint32_t Us10 (uint64_t cycles) {
+  return (uint32_t)((cycles * 10000000U) / SystemCoreClock);
+}
+
+#if (DRIVERBENCH_SPI != 0)
+extern ARM_DRIVER_SPI DB_CONCAT(Driver_SPI, DRIVERBENCH_SPI);
+#define DB_SPI          (&DB_CONCAT(Driver_SPI, DRIVERBENCH_SPI))
+
+#ifdef DRIVERBENCH_SPI_HANDLE
+extern SPI_HandleTypeDef DRIVERBENCH_SPI_HANDLE;
+#endif
+
+static const uint32_t db_spi_clock[] = {
+  1000000U, 2000000U, 4000000U, 8000000U, 16000000U, 32000000U, 0U
+};
+
+static uint32_t SpiConfig (uint32_t clock) {
+  int32_t speed;
+
+  if (DB_SPI->Control(ARM_SPI_MODE_MASTER | ARM_SPI_CPOL0_CPHA0 | ARM_SPI_MSB_LSB |
+                      ARM_SPI_DATA_BITS(8) | ARM_SPI_SS_MASTER_UNUSED, clock) != ARM_DRIVER_OK) {
+    return 0U;
+  }
+  speed = DB_SPI->Control(ARM_SPI_GET_BUS_SPEED, 0U);
+  return (speed > 0) ? (uint32_t)speed : clock;
+}
+
+static uint32_t SpiBusy (void) {
+  return DB_SPI->GetStatus().busy;
+}
+
+static uint32_t SpiProbe (DB_Bus_t *bus) {
+  (void)bus;
+  DB_SPI->Transfer(db_tx, db_rx, 1U);
+  if (SpiBusy() == 0U) {
+    return 1U;
+  }
+  while (SpiBusy() != 0U);
+  return 0U;
+}
+
+static int32_t SpiStart (const uint8_t *tx, uint8_t *rx, uint32_t num) {
+  return DB_SPI->Transfer(tx, rx, num);
+}
+
+static void SpiAbort (void) {
+  DB_SPI->Control(ARM_SPI_ABORT_TRANSFER, 0U);
+}
+
+static uint32_t SpiDMA (void) {
+#ifdef DRIVERBENCH_SPI_HANDLE
+  return ((DRIVERBENCH_SPI_HANDLE.hdmatx != NULL) || (DRIVERBENCH_SPI_HANDLE.hdmarx != NULL)) ? 1U : 0U;
+#else
+  return 0U;
+#endif
+}
+
+static DB_Bus_t db_spi = {
+  "spi", db_spi_clock, 8U,
+  ARM_SPI_EVENT_TRANSFER_COMPLETE, ARM_SPI_EVENT_DATA_LOST | ARM_SPI_EVENT_MODE_FAULT, 1U,
+  SpiConfig, SpiProbe, SpiStart, SpiBusy, SpiAbort, SpiDMA
+};
+#endif
+
+#if (DRIVERBENCH_USART != 0)
+extern ARM_DRIVER_USART DB_CONCAT(Driver_USART, DRIVERBENCH_USART);
+#define DB_USART        (&DB_CONCAT(Driver_USART, DRIVERBENCH_USART))
+
+#ifdef DRIVERBENCH_USART_HANDLE
+extern UART_HandleTypeDef DRIVERBENCH_USART_HANDLE;
+#endif
+
+static const uint32_t db_usart_clock[] = {
+  115200U, 460800U, 921600U, 2000000U, 4000000U, 6000000U, 0U
+};
+
+static uint32_t UsartConfig (uint32_t baudrate) {
+
+  if (DB_USART->Control(ARM_USART_MODE_ASYNCHRONOUS | ARM_USART_DATA_BITS_8 | ARM_USART_PARITY_NONE |
+                        ARM_USART_STOP_BITS_1 | ARM_USART_FLOW_CONTROL_NONE, baudrate) != ARM_DRIVER_OK) {
+    return 0U;
+  }
+  DB_USART->Control(ARM_USART_CONTROL_TX, 1U);
+  DB_USART->Control(ARM_USART_CONTROL_RX, 1U);
+  return baudrate;
+}
+
+static uint32_t UsartBusy (void) {
+  ARM_USART_STATUS status = DB_USART->GetStatus();
+
+  return (status.tx_busy | status.rx_busy);
+}
+
+static int32_t UsartStart (const uint8_t *tx, uint8_t *rx, uint32_t num) {
+  int32_t status;
+
+  status = DB_USART->Receive(rx, num);
+  if (status == ARM_DRIVER_OK) {
+    status = DB_USART->Send(tx, num);
+  }
+  return status;
+}
+
+static int32_t UsartSend (const uint8_t *tx, uint8_t *rx, uint32_t num) {
+  (void)rx;
+  return DB_USART->Send(tx, num);
+}
+
+static void UsartAbort (void) {
+  DB_USART->Control(ARM_USART_ABORT_SEND, 0U);
+  DB_USART->Control(ARM_USART_ABORT_RECEIVE, 0U);
+}
+
+static uint32_t UsartDMA (void) {
+#ifdef DRIVERBENCH_USART_HANDLE
+  return ((DRIVERBENCH_USART_HANDLE.hdmatx != NULL) || (DRIVERBENCH_USART_HANDLE.hdmarx != NULL)) ? 1U : 0U;
+#else
+  return 0U;
+#endif
+}
+
+/* Send one byte; an asynchronous driver receives it again to empty RX */
+static uint32_t UsartProbe (DB_Bus_t *bus) {
+  db_event = 0U;
+  DB_USART->Send(db_tx, 1U);
+  if (DB_USART->GetStatus().tx_busy == 0U) {
+    bus->start  = UsartSend;            // Blocking: measure Send only
+    bus->done   = ARM_USART_EVENT_SEND_COMPLETE;
+    bus->verify = 0U;
+    return 1U;
+  }
+  DB_USART->Receive(db_rx, 1U);
+  while (UsartBusy() != 0U);
+  return 0U;
+}
+
+static DB_Bus_t db_usart = {
+  "usart", db_usart_clock, 10U,
+  ARM_USART_EVENT_SEND_COMPLETE | ARM_USART_EVENT_RECEIVE_COMPLETE,
+  ARM_USART_EVENT_RX_OVERFLOW | ARM_USART_EVENT_RX_FRAMING_ERROR | ARM_USART_EVENT_RX_PARITY_ERROR, 1U,
+  UsartConfig, UsartProbe, UsartStart, UsartBusy, UsartAbort, UsartDMA
+};
+#endif
+
+/* Transfers of one size, returns 0 when the driver rejects the transfer */
+static uint32_t Measure (DB_Bus_t *bus, uint32_t blocking, uint32_t clock, uint32_t size, DB_Result_t *r) {
+  uint32_t n, i, start, end, cycles, loops, timeout;
+  int32_t  status;
+
+  r->transfers = DRIVERBENCH_BYTES / size;
+  if (r->transfers < DB_TRANSFER_MIN) {
+    r->transfers = DB_TRANSFER_MIN;
+  }
+  r->errors  = 0U;
+  r->lat_min = 0xFFFFFFFFU;
+  r->lat_max = 0U;
+  r->cycles  = 0U;
+  r->idle    = 0U;
+
+  // Four times the time on the bus plus 10 ms
+  timeout = (uint32_t)((((uint64_t)size * bus->bits * SystemCoreClock) / clock) * 4U) +
+            (SystemCoreClock / 100U);
+
+  for (n = 0U; n < r->transfers; n++) {
+    for (i = 0U; i < size; i++) {
+      db_tx[i] = (uint8_t)((i * 7U) + n);
+    }
+    memset(db_rx, 0, size);
+    db_event   = 0U;
+    db_timeout = 0U;
+
+    start  = DWT->CYCCNT;
+    status = bus->start(db_tx, db_rx, size);
+    end    = DWT->CYCCNT;
+    if (status != ARM_DRIVER_OK) {
+      return 0U;
+    }
+    loops = 0U;
+    if (blocking == 0U) {
+      loops = IdleWait(bus->done, start, timeout);
+      end   = db_end;
+    }
+    if (db_timeout != 0U) {
+      bus->abort();
+      end = start + timeout;
+    }
+    cycles = end - start;
+
+    if ((db_timeout != 0U) || ((db_event & bus->error) != 0U) ||
+        ((bus->verify != 0U) && (memcmp(db_rx, db_tx, size) != 0))) {
+      r->errors++;
+    }
+    if (cycles < r->lat_min) r->lat_min = cycles;
+    if (cycles > r->lat_max) r->lat_max = cycles;
+    r->cycles += cycles;
+    r->idle   += ((uint64_t)loops * db_loop_x16) / 16U;
+  }
+  return 1U;
+}
+
+/* All clocks and sizes of one bus */
+static void RunBus (DB_Bus_t *bus) {
+  DB_Result_t r;
+  const char *mode;
+  uint32_t    c, s, clock, last, probed, blocking, idle;
+  uint64_t    bytes;
+
+  last     = 0U;
+  probed   = 0U;
+  blocking = 0U;
+  mode     = "irq";
+  for (c = 0U; bus->clock[c] != 0U; c++) {
+    clock = bus->config(bus->clock[c]);
+    if (clock == 0U) {
+      printf("# %s %u: clock not supported\n", bus->name, (unsigned int)bus->clock[c]);
+      continue;
+    }
+    if (clock == last) {
+      continue;
+    }
+    last = clock;
+    if (probed == 0U) {
+      probed   = 1U;
+      blocking = bus->probe(bus);
+      mode     = (blocking != 0U) ? "blocking" : ((bus->dma() != 0U) ? "dma" : "irq");
+    }
+
+    for (s = 0U; s < (sizeof(db_size) / sizeof(db_size[0])); s++) {
+      if (Measure(bus, blocking, clock, db_size[s], &r) == 0U) {
+        printf("# %s %u bytes: transfer rejected\n", bus->name, (unsigned int)db_size[s]);
+        break;
+      }
+      bytes = (uint64_t)db_size[s] * r.transfers;
+      idle  = (r.cycles != 0U) ? (uint32_t)((r.idle * 1000U) / r.cycles) : 0U;
+      if (idle > 1000U) {
+        idle = 1000U;
+      }
+      printf("%s,%s,%u,%u,%u,%u,%u.%u,%u.%u,%u.%u,%u.%u,%u\n",
+             bus->name, mode, (unsigned int)clock, (unsigned int)db_size[s], (unsigned int)r.transfers,
+             (unsigned int)((bytes * SystemCoreClock) / r.cycles),
+             (unsigned int)(Us10(r.lat_min) / 10U), (unsigned int)(Us10(r.lat_min) % 10U),
+             (unsigned int)(Us10(r.cycles / r.transfers) / 10U), (unsigned int)(Us10(r.cycles / r.transfers) % 10U),
+             (unsigned int)(Us10(r.lat_max) / 10U), (unsigned int)(Us10(r.lat_max) % 10U),
+             (unsigned int)(idle / 10U), (unsigned int)(idle % 10U),
+             (unsigned int)r.errors);
+    }
+  }
+}
+
+void DriverBench_Run (void) {
+
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+  IdleCalibrate();
+
+  printf("# DriverBench SystemCoreClock=%u wait loop=%u/16 cycles\n",
+         (unsigned int)SystemCoreClock, (unsigned int)db_loop_x16);
+  printf("bus,mode,clock,size,transfers,bytes_per_s,lat_min_us,lat_avg_us,lat_max_us,idle_pct,errors\n");
+
+#if (DRIVERBENCH_SPI != 0)
+  DB_SPI->Initialize(DB_Event);
+  DB_SPI->PowerControl(ARM_POWER_FULL);
+  RunBus(&db_spi);
+  DB_SPI->PowerControl(ARM_POWER_OFF);
+  DB_SPI->Uninitialize();
+#endif
+
+#if (DRIVERBENCH_USART != 0)
+  DB_USART->Initialize(DB_Event);
+  DB_USART->PowerControl(ARM_POWER_FULL);
+  RunBus(&db_usart);
+  DB_USART->PowerControl(ARM_POWER_OFF);
+  DB_USART->Uninitialize();
+#endif
+}
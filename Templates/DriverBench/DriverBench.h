@@ -0,0 +1,52 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      CMSIS-Driver SPI/USART benchmark for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Call DriverBench_Run from main.c (USER CODE BEGIN 2) once CubeMX has set
+   up the clocks and peripherals. SPI needs MOSI wired to MISO and USART TX
+   wired to RX; the STM32WBA SPI and USART have no internal loopback.
+   The CMSIS-Driver_STM32 shim selects blocking, interrupt or DMA transfers
+   from the CubeMX configuration of the peripheral, so each mode is one
+   CubeMX configuration and one run of the benchmark.  */
+
+#ifndef DRIVER_BENCH_H
+#define DRIVER_BENCH_H
+
+#include <stdint.h>
+
+// SPI driver instance (Driver_SPIn), 0 to skip SPI
+#ifndef DRIVERBENCH_SPI
+#define DRIVERBENCH_SPI             1
+#endif
+
+// USART driver instance (Driver_USARTn), 0 to skip USART
+#ifndef DRIVERBENCH_USART
+#define DRIVERBENCH_USART           1
+#endif
+
+// CubeMX HAL handles, used to report DMA mode (comment out when not available)
+#define DRIVERBENCH_SPI_HANDLE      hspi1
+#define DRIVERBENCH_USART_HANDLE    huart1
+
+// Bytes transferred per bus clock and transfer size (at least 4 transfers)
+#ifndef DRIVERBENCH_BYTES
+#define DRIVERBENCH_BYTES           16384U
+#endif
+
+/**
+  \fn          void DriverBench_Run (void)
+  \brief       Run SPI and USART transfers for all bus clocks and sizes and print
+               a CSV table (bus,mode,clock,size,transfers,bytes_per_s,lat_min_us,
+               lat_avg_us,lat_max_us,idle_pct,errors) to stdout.
+*/
+extern void DriverBench_Run (void);
+
+#endif /* DRIVER_BENCH_H */
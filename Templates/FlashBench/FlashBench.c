@@ -0,0 +1,296 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Flash and ICACHE benchmark for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Kernels execute from flash and are measured for every combination of
+     FLASH_ACR LATENCY  configured value .. + FLASHBENCH_LATENCY_STEPS - 1
+     FLASH_ACR PRFTEN   0, 1
+     ICACHE             off, 1-way (direct mapped), 2-way
+   Cycles are DWT CYCCNT per kernel call, hits/misses the ICACHE monitors
+   over FLASHBENCH_REPEAT calls (MISSMON saturates at 0xFFFF).
+   Kernels:
+     seq     straight-line code (about 6 KB)
+     branch  data dependent branches and a switch
+     table   CRC-32 with a 1 KB constant table
+     const   sequential read of a 32 KB constant array  */
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "FlashBench.h"
+
+#if defined(__ICCARM__)
+#define FB_NOINLINE       _Pragma("inline=never")
+#else
+#define FB_NOINLINE       __attribute__((noinline))
+#endif
+
+#define FB_ICACHE_OFF     0U
+#define FB_ICACHE_1WAY    1U
+#define FB_ICACHE_2WAY    2U
+
+typedef uint32_t (*FB_Kernel_t) (uint32_t arg);
+
+typedef struct {
+  const char  *name;
+  FB_Kernel_t  fn;
+} FB_Test_t;
+
+static const char * const fb_icache_name[3] = { "off", "1-way", "2-way" };
+
+static volatile uint32_t fb_sink;
+static uint8_t           fb_buf[1024];
+
+static const uint32_t fb_crc_tab[256] = {
+  0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU,
+  0x076DC419U, 0x706AF48FU, 0xE963A535U, 0x9E6495A3U,
+  0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U,
+  0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U,
+  0x1DB71064U, 0x6AB020F2U, 0xF3B97148U, 0x84BE41DEU,
+  0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+  0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU,
+  0x14015C4FU, 0x63066CD9U, 0xFA0F3D63U, 0x8D080DF5U,
+  0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U,
+  0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU,
+  0x35B5A8FAU, 0x42B2986CU, 0xDBBBC9D6U, 0xACBCF940U,
+  0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+  0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U,
+  0x21B4F4B5U, 0x56B3C423U, 0xCFBA9599U, 0xB8BDA50FU,
+  0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U,
+  0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU,
+  0x76DC4190U, 0x01DB7106U, 0x98D220BCU, 0xEFD5102AU,
+  0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+  0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U,
+  0x7F6A0DBBU, 0x086D3D2DU, 0x91646C97U, 0xE6635C01U,
+  0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU,
+  0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U,
+  0x65B0D9C6U, 0x12B7E950U, 0x8BBEB8EAU, 0xFCB9887CU,
+  0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+  0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U,
+  0x4ADFA541U, 0x3DD895D7U, 0xA4D1C46DU, 0xD3D6F4FBU,
+  0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U,
+  0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U,
+  0x5005713CU, 0x270241AAU, 0xBE0B1010U, 0xC90C2086U,
+  0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+  0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U,
+  0x59B33D17U, 0x2EB40D81U, 0xB7BD5C3BU, 0xC0BA6CADU,
+  0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU,
+  0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U,
+  0xE3630B12U, 0x94643B84U, 0x0D6D6A3EU, 0x7A6A5AA8U,
+  0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+  0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU,
+  0xF762575DU, 0x806567CBU, 0x196C3671U, 0x6E6B06E7U,
+  0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU,
+  0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U,
+  0xD6D6A3E8U, 0xA1D1937EU, 0x38D8C2C4U, 0x4FDFF252U,
+  0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+  0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U,
+  0xDF60EFC3U, 0xA867DF55U, 0x316E8EEFU, 0x4669BE79U,
+  0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U,
+  0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU,
+  0xC5BA3BBEU, 0xB2BD0B28U, 0x2BB45A92U, 0x5CB36A04U,
+  0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+  0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU,
+  0x9C0906A9U, 0xEB0E363FU, 0x72076785U, 0x05005713U,
+  0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U,
+  0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U,
+  0x86D3D2D4U, 0xF1D4E242U, 0x68DDB3F8U, 0x1FDA836EU,
+  0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+  0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU,
+  0x8F659EFFU, 0xF862AE69U, 0x616BFFD3U, 0x166CCF45U,
+  0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U,
+  0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU,
+  0xAED16A4AU, 0xD9D65ADCU, 0x40DF0B66U, 0x37D83BF0U,
+  0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+  0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U,
+  0xBAD03605U, 0xCDD70693U, 0x54DE5729U, 0x23D967BFU,
+  0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U,
+  0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU
+};
+
+// Placed in flash; contents do not matter, only the read traffic
+static const uint32_t fb_const[8192] = { 1U };
+
+/* Straight-line code: 512 dependent operations without branches */
+#define FB_OP             a = (a * 33U) + b; b ^= a >> 7;
+#define FB_OP8            FB_OP FB_OP FB_OP FB_OP FB_OP FB_OP FB_OP FB_OP
+#define FB_OP64           FB_OP8 FB_OP8 FB_OP8 FB_OP8 FB_OP8 FB_OP8 FB_OP8 FB_OP8
+
+FB_NOINLINE static uint32_t KernelSeq (uint32_t arg) {
+  uint32_t a = arg;
+  uint32_t b = ~arg;
+
+  FB_OP64 FB_OP64 FB_OP64 FB_OP64 FB_OP64 FB_OP64 FB_OP64 FB_OP64
+  return (a ^ b);
+}
+
+/* Branchy code: xorshift driven switch and conditional */
+FB_NOINLINE static uint32_t KernelBranch (uint32_t arg) {
+  uint32_t x   = arg | 1U;
+  uint32_t acc = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < 1024U; i++) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x <<  5;
+    switch (x & 7U) {
+      case 0:  acc += x;          break;
+      case 1:  acc ^= x >> 3;     break;
+      case 2:  acc -= x << 2;     break;
+      case 3:  acc  = (acc << 1) | (acc >> 31); break;
+      case 4:  acc += i;          break;
+      case 5:  acc ^= 0x5A5A5A5AU; break;
+      case 6:  acc *= 3U;         break;
+      default: acc  = ~acc;       break;
+    }
+    if ((x & 0x100U) != 0U) {
+      acc += 7U;
+    } else {
+      acc -= 1U;
+    }
+  }
+  return acc;
+}
+
+/* Table lookup: CRC-32 over a RAM buffer */
+FB_NOINLINE static uint32_t KernelTable (uint32_t arg) {
+  uint32_t crc = ~arg;
+  uint32_t i;
+
+  for (i = 0U; i < sizeof(fb_buf); i++) {
+    crc = fb_crc_tab[(crc ^ fb_buf[i]) & 0xFFU] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+/* Large constant reads */
+FB_NOINLINE static uint32_t KernelConst (uint32_t arg) {
+  const volatile uint32_t *p = fb_const;
+  uint32_t sum = arg;
+  uint32_t i;
+
+  for (i = 0U; i < (sizeof(fb_const) / sizeof(fb_const[0])); i += 4U) {
+    sum += p[i] + p[i + 1U] + p[i + 2U] + p[i + 3U];
+  }
+  return sum;
+}
+
+static const FB_Test_t fb_test[] = {
+  { "seq",    KernelSeq    },
+  { "branch", KernelBranch },
+  { "table",  KernelTable  },
+  { "const",  KernelConst  }
+};
+
+/* Set flash latency and prefetch */
+static void SetFlash (uint32_t latency, uint32_t prften) {
+  uint32_t acr;
+
+  acr  = FLASH->ACR & ~(FLASH_ACR_LATENCY | FLASH_ACR_PRFTEN);
+  acr |= latency << FLASH_ACR_LATENCY_Pos;
+  if (prften != 0U) {
+    acr |= FLASH_ACR_PRFTEN;
+  }
+  FLASH->ACR = acr;
+  while ((FLASH->ACR & FLASH_ACR_LATENCY) != (acr & FLASH_ACR_LATENCY));  // active when read back
+}
+
+/* Disable, invalidate and optionally re-enable the ICACHE */
+static void SetICache (uint32_t mode) {
+
+  ICACHE->CR &= ~ICACHE_CR_EN;
+  while ((ICACHE->SR & ICACHE_SR_BUSYF) != 0U);
+
+  ICACHE->CR  = (mode == FB_ICACHE_2WAY) ? ICACHE_CR_WAYSEL : 0U;  // WAYSEL only when disabled
+  ICACHE->CR |= ICACHE_CR_CACHEINV;
+  while ((ICACHE->SR & ICACHE_SR_BSYENDF) == 0U);
+  ICACHE->FCR = ICACHE_FCR_CBSYENDF;
+
+  if (mode != FB_ICACHE_OFF) {
+    ICACHE->CR |= ICACHE_CR_EN | ICACHE_CR_HITMEN | ICACHE_CR_MISSMEN;
+  }
+}
+
+/* Cycles per kernel call */
+static uint32_t Measure (FB_Kernel_t fn, uint32_t *hits, uint32_t *misses) {
+  uint32_t primask, start, cycles, n;
+
+  fb_sink += fn(0U);                    // warm-up
+
+  ICACHE->CR |=  (ICACHE_CR_HITMRST | ICACHE_CR_MISSMRST);
+  ICACHE->CR &= ~(ICACHE_CR_HITMRST | ICACHE_CR_MISSMRST);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  start = DWT->CYCCNT;
+  for (n = 0U; n < FLASHBENCH_REPEAT; n++) {
+    fb_sink += fn(n);
+  }
+  cycles = DWT->CYCCNT - start;
+  __set_PRIMASK(primask);
+
+  *hits   = ICACHE->HMONR;
+  *misses = ICACHE->MMONR;
+
+  return (cycles / FLASHBENCH_REPEAT);
+}
+
+void FlashBench_Run (void) {
+  uint32_t acr, icr, lat, lat_max, pf, ic, k;
+  uint32_t cycles, hits, misses;
+
+  acr = FLASH->ACR;
+  icr = ICACHE->CR;
+
+  DCB->DEMCR  |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT  = 0U;
+  DWT->CTRL   |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (k = 0U; k < sizeof(fb_buf); k++) {
+    fb_buf[k] = (uint8_t)(k * 7U);
+  }
+
+  lat     = (acr & FLASH_ACR_LATENCY) >> FLASH_ACR_LATENCY_Pos;
+  lat_max = lat + FLASHBENCH_LATENCY_STEPS - 1U;
+  if (lat_max > (FLASH_ACR_LATENCY >> FLASH_ACR_LATENCY_Pos)) {
+    lat_max = FLASH_ACR_LATENCY >> FLASH_ACR_LATENCY_Pos;
+  }
+
+  printf("# FlashBench SystemCoreClock=%u\n", (unsigned int)SystemCoreClock);
+  printf("kernel,latency,prften,icache,cycles,hits,misses\n");
+
+  for (; lat <= lat_max; lat++) {
+    for (pf = 0U; pf < 2U; pf++) {
+      for (ic = FB_ICACHE_OFF; ic <= FB_ICACHE_2WAY; ic++) {
+        SetFlash(lat, pf);
+        SetICache(ic);
+        for (k = 0U; k < (sizeof(fb_test) / sizeof(fb_test[0])); k++) {
+          cycles = Measure(fb_test[k].fn, &hits, &misses);
+          printf("%s,%u,%u,%s,%u,%u,%u\n", fb_test[k].name,
+                 (unsigned int)lat, (unsigned int)pf, fb_icache_name[ic],
+                 (unsigned int)cycles, (unsigned int)hits, (unsigned int)misses);
+        }
+      }
+    }
+  }
+
+  // Restore the CubeMX configuration
+  SetICache(FB_ICACHE_OFF);
+  ICACHE->CR = icr & ~ICACHE_CR_EN;
+  ICACHE->CR = icr;
+  FLASH->ACR = acr;
+  while ((FLASH->ACR & FLASH_ACR_LATENCY) != (acr & FLASH_ACR_LATENCY));
+
+  printf("# FlashBench done\n");
+}
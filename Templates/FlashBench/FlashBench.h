@@ -0,0 +1,39 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      Flash and ICACHE benchmark for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Call FlashBench_Run from main.c (USER CODE BEGIN 2) once CubeMX has set
+   up the system clock. The FLASH_ACR latency configured by CubeMX is used
+   as the minimum for the clock; the benchmark only adds wait states.  */
+
+#ifndef FLASH_BENCH_H
+#define FLASH_BENCH_H
+
+#include <stdint.h>
+
+// Number of latency settings measured, starting at the configured one
+#ifndef FLASHBENCH_LATENCY_STEPS
+#define FLASHBENCH_LATENCY_STEPS    4U
+#endif
+
+// Kernel calls measured per configuration (after one warm-up call)
+#ifndef FLASHBENCH_REPEAT
+#define FLASHBENCH_REPEAT           8U
+#endif
+
+/**
+  \fn          void FlashBench_Run (void)
+  \brief       Run all kernels in all configurations and print a CSV table
+               (kernel,latency,prften,icache,cycles,hits,misses) to stdout.
+*/
+extern void FlashBench_Run (void);
+
+#endif /* FLASH_BENCH_H */
@@ -0,0 +1,200 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      SRAM code placement for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Each kernel is built three times from the same source: in flash, with
+   RAMFUNC and with RAMFUNC_SRAM2. The benchmark reports the minimum and
+   maximum DWT cycles of RAMCODE_REPEAT calls, once with the ICACHE as
+   configured ("warm") and once invalidated before every call ("cold"),
+   which shows the worst case latency of code that was evicted.
+   Kernels:
+     fir     16-tap integer FIR over 64 samples
+     crc     bitwise CRC-32 over 64 bytes (data dependent branches)
+     isr     short handler: a few loads, stores and a decision  */
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "RamCode.h"
+
+#ifndef RAMCODE_REPEAT
+#define RAMCODE_REPEAT    32U
+#endif
+
+#if defined(__ICCARM__)
+#define RC_NOINLINE       _Pragma("inline=never")
+#else
+#define RC_NOINLINE       __attribute__((noinline))
+#endif
+
+typedef uint32_t (*RC_Kernel_t) (void);
+
+typedef struct {
+  const char  *name;
+  const char  *memory;
+  RC_Kernel_t  fn;
+} RC_Test_t;
+
+static int16_t           rc_samples[64 + 16];
+static uint8_t           rc_bytes[64];
+static volatile uint32_t rc_state[4];
+static volatile uint32_t rc_sink;
+
+static const int16_t rc_coef[16] = {
+   -12,  -35,  -41,    8,  127,  318,  519,  644,
+   644,  519,  318,  127,    8,  -41,  -35,  -12
+};
+
+#define RC_KERNEL_FIR(name, attr)                               \
+  attr uint32_t name (void) {                                   \
+    uint32_t i, k;                                              \
+    int32_t  acc, sum = 0;                                      \
+    for (i = 0U; i < 64U; i++) {                                \
+      acc = 0;                                                  \
+      for (k = 0U; k < 16U; k++) {                              \
+        acc += rc_samples[i + k] * rc_coef[k];                  \
+      }                                                         \
+      sum += acc >> 10;                                         \
+    }                                                           \
+    return (uint32_t)sum;                                       \
+  }
+
+#define RC_KERNEL_CRC(name, attr)                               \
+  attr uint32_t name (void) {                                   \
+    uint32_t crc = 0xFFFFFFFFU;                                 \
+    uint32_t i, b;                                              \
+    for (i = 0U; i < sizeof(rc_bytes); i++) {                   \
+      crc ^= rc_bytes[i];                                       \
+      for (b = 0U; b < 8U; b++) {                               \
+        if ((crc & 1U) != 0U) {                                 \
+          crc = (crc >> 1) ^ 0xEDB88320U;                       \
+        } else {                                                \
+          crc >>= 1;                                            \
+        }                                                       \
+      }                                                         \
+    }                                                           \
+    return ~crc;                                                \
+  }
+
+#define RC_KERNEL_ISR(name, attr)                               \
+  attr uint32_t name (void) {                                   \
+    uint32_t s = rc_state[0];                                   \
+    if ((s & 1U) != 0U) {                                       \
+      rc_state[1] += s;                                         \
+    } else {                                                    \
+      rc_state[2] ^= s;                                         \
+    }                                                           \
+    rc_state[0] = s + 1U;                                       \
+    rc_state[3]++;                                              \
+    return s;                                                   \
+  }
+
+RC_KERNEL_FIR(FirFlash, RC_NOINLINE static)
+RC_KERNEL_FIR(FirSram1, RAMFUNC)
+RC_KERNEL_FIR(FirSram2, RAMFUNC_SRAM2)
+
+RC_KERNEL_CRC(CrcFlash, RC_NOINLINE static)
+RC_KERNEL_CRC(CrcSram1, RAMFUNC)
+RC_KERNEL_CRC(CrcSram2, RAMFUNC_SRAM2)
+
+RC_KERNEL_ISR(IsrFlash, RC_NOINLINE static)
+RC_KERNEL_ISR(IsrSram1, RAMFUNC)
+RC_KERNEL_ISR(IsrSram2, RAMFUNC_SRAM2)
+
+static const RC_Test_t rc_test[] = {
+  { "fir", "flash", FirFlash },
+  { "fir", "sram1", FirSram1 },
+  { "fir", "sram2", FirSram2 },
+  { "crc", "flash", CrcFlash },
+  { "crc", "sram1", CrcSram1 },
+  { "crc", "sram2", CrcSram2 },
+  { "isr", "flash", IsrFlash },
+  { "isr", "sram1", IsrSram1 },
+  { "isr", "sram2", IsrSram2 }
+};
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+extern uint32_t __ramfunc2_load[];
+extern uint32_t __ramfunc2_start[];
+extern uint32_t __ramfunc2_end[];
+#endif
+
+void RamCode_Init (void) {
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+  // The CubeMX startup file copies .data (with .ramfunc) only
+  const uint32_t *src = __ramfunc2_load;
+  uint32_t       *dst = __ramfunc2_start;
+
+  while (dst < __ramfunc2_end) {
+    *dst++ = *src++;
+  }
+  __DSB();
+  __ISB();
+#endif
+}
+
+/* Invalidate the ICACHE when it is enabled */
+static void ICacheInvalidate (void) {
+  if ((ICACHE->CR & ICACHE_CR_EN) != 0U) {
+    ICACHE->CR |= ICACHE_CR_CACHEINV;
+    while ((ICACHE->SR & ICACHE_SR_BSYENDF) == 0U);
+    ICACHE->FCR = ICACHE_FCR_CBSYENDF;
+  }
+}
+
+/* Minimum and maximum cycles of one kernel call */
+static void Measure (RC_Kernel_t fn, uint32_t cold, uint32_t *min, uint32_t *max) {
+  uint32_t primask, start, cycles, n;
+
+  *min = 0xFFFFFFFFU;
+  *max = 0U;
+  fn();                                 // warm-up
+  for (n = 0U; n < RAMCODE_REPEAT; n++) {
+    if (cold != 0U) {
+      ICacheInvalidate();
+    }
+    primask = __get_PRIMASK();
+    __disable_irq();
+    start    = DWT->CYCCNT;
+    rc_sink += fn();
+    cycles   = DWT->CYCCNT - start;
+    __set_PRIMASK(primask);
+    if (cycles < *min) *min = cycles;
+    if (cycles > *max) *max = cycles;
+  }
+}
+
+void RamCode_Bench (void) {
+  uint32_t i, cold, min, max;
+
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (i = 0U; i < (sizeof(rc_samples) / sizeof(rc_samples[0])); i++) {
+    rc_samples[i] = (int16_t)((i * 2654435761U) >> 20);
+  }
+  for (i = 0U; i < sizeof(rc_bytes); i++) {
+    rc_bytes[i] = (uint8_t)(i * 37U);
+  }
+
+  printf("# RamCode SystemCoreClock=%u ICACHE=%s\n", (unsigned int)SystemCoreClock,
+         ((ICACHE->CR & ICACHE_CR_EN) != 0U) ? "on" : "off");
+  printf("kernel,memory,cache,min,max\n");
+  for (cold = 0U; cold < 2U; cold++) {
+    for (i = 0U; i < (sizeof(rc_test) / sizeof(rc_test[0])); i++) {
+      Measure(rc_test[i].fn, cold, &min, &max);
+      printf("%s,%s,%s,%u,%u\n", rc_test[i].name, rc_test[i].memory,
+             (cold != 0U) ? "cold" : "warm", (unsigned int)min, (unsigned int)max);
+    }
+  }
+}
@@ -0,0 +1,47 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 ARM Ltd.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      SRAM code placement for ST STM32WBAx
+ * --------------------------------------------------------------------------- */
+
+/* Note:
+   Mark time critical functions, for example interrupt handlers, with
+     RAMFUNC        execute from SRAM1
+     RAMFUNC_SRAM2  execute from SRAM2
+   The linker scripts of this template load them into flash and the startup
+   code copies them to SRAM. Calls between flash and SRAM use veneers that
+   the linker adds automatically.  */
+
+#ifndef RAM_CODE_H
+#define RAM_CODE_H
+
+#include <stdint.h>
+
+#if defined(__ICCARM__)
+#define RAMFUNC           _Pragma("location=\".ramfunc\"")       _Pragma("inline=never")
+#define RAMFUNC_SRAM2     _Pragma("location=\".ramfunc.sram2\"") _Pragma("inline=never")
+#else
+#define RAMFUNC           __attribute__((section(".ramfunc"),       noinline))
+#define RAMFUNC_SRAM2     __attribute__((section(".ramfunc.sram2"), noinline))
+#endif
+
+/**
+  \fn          void RamCode_Init (void)
+  \brief       Copy RAMFUNC_SRAM2 functions when the startup code does not
+               (GCC with the CubeMX startup file). Call before the first use.
+*/
+extern void RamCode_Init (void);
+
+/**
+  \fn          void RamCode_Bench (void)
+  \brief       Run the kernels from flash, SRAM1 and SRAM2 and print a CSV
+               table (kernel,memory,icache,min,max) to stdout.
+*/
+extern void RamCode_Bench (void);
+
+#endif /* RAM_CODE_H */
@@ -30,6 +30,7 @@ DEFAULT_ARGS=(-c "v")
 #
 PACK_DIRS="
   CMSIS
+  Components
   Documents
   Templates
 "
@@ -44,9 +45,10 @@ PACK_BASE_FILES="
 # Specify file names to be deleted from pack build directory
 # Default: empty
 #
-# PACK_DELETE_FILES="
-#   <list files here>
-# "
+PACK_DELETE_FILES="
+  CMSIS/Flash/Tools/Test
+  Components/KVStore/Test
+"
 
 # Specify patches to be applied
 # Default: empty
@@ -86,6 +88,7 @@ PACKCHK_ARGS=(--allow-suppress-error -x M350 -x M371)
 function preprocess() {
   # add custom steps here to be executed
   # before populating the pack build folder
+  python3 CMSIS/SVD/Tools/svd2cpp.py CMSIS/SVD/*.svd -o CMSIS/SVD/Include || return 1
   return 0
 }
 